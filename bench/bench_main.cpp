@@ -0,0 +1,303 @@
+/**
+ * TinyJson Benchmarks
+ * -----------------------------------------------------------------------------
+ * Measures parser throughput (MB/s) on a synthetic document, or on a JSON
+ * file passed as the first argument. Each benchmark reports the best of
+ * several runs so that numbers are comparable between builds.
+ * -----------------------------------------------------------------------------
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include "TinyJson.h"
+
+using namespace TinyJson;
+
+// Compile : g++ -O2 -o TinyJsonBench -I./include src/TinyJson.cpp bench/bench_main.cpp
+// Run     : ./TinyJsonBench [file.json]
+
+// =============================================================================
+// [Bench Helpers]
+// =============================================================================
+namespace {
+
+const int RUNS = 5;
+
+/**
+ * @brief Builds an array of same-shaped records (~size bytes of JSON text).
+ */
+std::string makeDocument( std::size_t size )
+{
+    std::string doc = "[\n";
+    for( std::size_t i = 0; doc.size() < size; ++i )
+    {
+        if( i > 0 ) doc += ",\n";
+        doc += "  { \"id\": " + std::to_string( i )
+             + ", \"name\": \"user_" + std::to_string( i ) + "\""
+             + ", \"score\": " + std::to_string( i % 1000 ) + "." + std::to_string( i % 97 )
+             + ", \"active\": " + ( i % 2 ? "true" : "false" )
+             + ", \"tags\": [ \"alpha\", \"beta\", \"gamma\" ]"
+             + ", \"geo\": { \"lat\": 37.5665, \"lng\": 126.978, \"note\": null }"
+             + ", \"bio\": \"line one\\nline \\\"two\\\"\" }";
+    }
+    doc += "\n]\n";
+    return doc;
+}
+
+/**
+ * @brief Runs fn() RUNS times and prints the best throughput over `bytes`.
+ */
+template <typename Fn>
+void report( const char* name, std::size_t bytes, Fn fn )
+{
+    double best = 1e100;
+    for( int r = 0; r < RUNS; ++r )
+    {
+        auto t0 = std::chrono::steady_clock::now();
+        fn();
+        auto t1 = std::chrono::steady_clock::now();
+        best = std::min( best, std::chrono::duration<double>( t1 - t0 ).count() );
+    }
+
+    const double mb = bytes / ( 1024.0 * 1024.0 );
+    std::printf( "  %-28s %8.2f MB  %9.3f ms  %9.1f MB/s\n", name, mb, best * 1e3, mb / best );
+}
+
+} // namespace
+
+// =============================================================================
+// [Main Function]
+// =============================================================================
+int main( int argc, char** argv )
+{
+    try
+    {
+        std::string doc;
+        if( argc > 1 ) {
+            std::ifstream ifs( argv[1] );
+            std::stringstream ss;
+            ss << ifs.rdbuf();
+            doc = ss.str();
+        } else {
+            doc = makeDocument( 16 * 1024 * 1024 );
+        }
+
+        std::printf( "[ Parser ]\n" );
+
+        report( "Parser::parse", doc.size(), [&]() {
+            Json js = Parser::parse( doc );
+            if( js.size() == 0 ) std::printf( "empty document\n" );
+        });
+
+        // The same parse with UTF-8 validation fused into the first pass
+        ParseOptions strict;
+        strict.validateUtf8 = true;
+        report( "Parser::parse (UTF-8 check)", doc.size(), [&]() {
+            Json js = Parser::parse( doc, strict );
+            if( js.size() == 0 ) std::printf( "empty document\n" );
+        });
+
+        // parseFile reads the same document back from disk
+        const char* tempFile = "bench_temp.json";
+        {
+            std::ofstream ofs( tempFile, std::ios::binary );
+            ofs << doc;
+        }
+        report( "Parser::parseFile", doc.size(), [&]() {
+            Json js = Parser::parseFile( tempFile );
+            if( js.size() == 0 ) std::printf( "empty document\n" );
+        });
+        std::remove( tempFile );
+
+        // StreamParser receives the document in socket-sized chunks
+        report( "StreamParser (64 KB chunks)", doc.size(), [&]() {
+            StreamParser sp;
+            for( std::size_t i = 0; i < doc.size(); i += 64 * 1024 ) {
+                sp.feed( doc.data() + i, std::min<std::size_t>( 64 * 1024, doc.size() - i ) );
+            }
+            sp.finish();
+            if( sp.next().size() == 0 ) std::printf( "empty document\n" );
+        });
+
+        // SAX handler that ignores every event: measures the parser without a DOM
+        report( "Parser::parse (SAX)", doc.size(), [&]() {
+            JsonHandler ignore;
+            Parser::parse( doc, ignore );
+        });
+
+        // Validation only: no index, no nodes, no allocation
+        report( "Parser::isObject", doc.size(), [&]() {
+            if( !Parser::isObject( doc ) ) std::printf( "invalid document\n" );
+        });
+
+        // Root array split at element boundaries and parsed on all cores
+        report( "Parser::parseParallel", doc.size(), [&]() {
+            Json js = Parser::parseParallel( doc );
+            if( js.size() == 0 ) std::printf( "empty document\n" );
+        });
+
+        // Lazy tree: validate everything, then read a few fields of one record
+        report( "Parser::parseLazy (3 reads)", doc.size(), [&]() {
+            Json js = Parser::parseLazy( doc );
+            const Json& rec = js[static_cast<int>( js.size() / 2 )];
+            if( rec["name"].getAs<std::string>().empty() || rec["geo"]["lat"].getAs<double>() == 0 )
+                std::printf( "empty record\n" );
+        });
+
+        // The same records as JSON Lines, parsed on all cores
+        {
+            std::string lines;
+            Json records = Parser::parse( doc );
+            for( const auto& r : records ) lines += r.toString() + "\n";
+
+            report( "Parser::parseLines", lines.size(), [&]() {
+                std::vector<Json> values = Parser::parseLines( lines );
+                if( values.empty() ) std::printf( "empty document\n" );
+            });
+        }
+
+        // Small malformed payloads: error codes instead of exceptions
+        {
+            const std::string bad = "{ \"id\": 42, \"name\": \"user\", \"tags\": [ \"a\", \"b\" ], \"ok\": tru }";
+            const int         count = 100000;
+            report( "Parser::tryParse (malformed)", bad.size() * count, [&]() {
+                Json out = JsonNULL();
+                for( int i = 0; i < count; ++i ) {
+                    if( Parser::tryParse( bad, out ) ) std::printf( "unexpected success\n" );
+                }
+            });
+        }
+
+        // Same nodes as parseInSitu, but the text copy and the nodes live in
+        // one arena that is freed in a single step
+        report( "Document::parse", doc.size(), [&]() {
+            Document d;
+            if( d.parse( doc ).size() == 0 ) std::printf( "empty document\n" );
+        });
+
+        // Frozen tape: one word array and one string buffer, nothing per node
+        report( "Parser::parseTape", doc.size(), [&]() {
+            TapeDocument tape = Parser::parseTape( doc );
+            if( tape.root().size() == 0 ) std::printf( "empty document\n" );
+        });
+
+        // In-situ parsing modifies its input, so each run works on a fresh
+        // copy (the copy is included in the timing)
+        std::string scratch;
+        report( "Parser::parseInSitu", doc.size(), [&]() {
+            scratch = doc;
+            ViewDocument view = Parser::parseInSitu( &scratch[0], scratch.size() );
+            if( view.root().size() == 0 ) std::printf( "empty document\n" );
+        });
+
+        std::printf( "[ Serializer ]\n" );
+
+        const Json parsed = Parser::parse( doc );
+        const std::size_t outSize = parsed.toString().size();
+        report( "Json::toString", outSize, [&]() {
+            if( parsed.toString().empty() ) std::printf( "empty output\n" );
+        });
+
+        // Number-only document: formatting dominates
+        Json numbers = JsonArray();
+        for( int i = 0; i < 500000; ++i ) {
+            numbers.addElementToArray( i * 7919LL, i / 7.0, 1e-9 * i );
+        }
+        const std::size_t numSize = numbers.toString().size();
+        report( "Json::toString (numbers)", numSize, [&]() {
+            if( numbers.toString().empty() ) std::printf( "empty output\n" );
+        });
+
+        // String-only document: escaping dominates
+        Json strings = JsonArray();
+        for( int i = 0; i < 200000; ++i ) {
+            strings.addElementToArray( "plain ascii text that needs no escaping at all " + std::to_string( i ),
+                                       "path\\to\\file \"quoted\"\tand\nnew line" );
+        }
+        const std::size_t strSize = strings.toString().size();
+        report( "Json::toString (strings)", strSize, [&]() {
+            if( strings.toString().empty() ) std::printf( "empty output\n" );
+        });
+
+        std::printf( "[ Access ]\n" );
+
+        // Every field of every record by name (bytes: the source text)
+        report( "Json::operator[] (by key)", doc.size(), [&]() {
+            std::size_t hits = 0;
+            for( const auto& rec : parsed ) {
+                hits += rec["id"].isInt() + rec["name"].isString() + rec["score"].isDouble()
+                      + rec["active"].isBool() + rec["tags"].isArray() + rec["bio"].isString()
+                      + rec["geo"]["lat"].isDouble() + rec["geo"].contains( "note" );
+            }
+            if( hits == 0 ) std::printf( "no fields\n" );
+        });
+
+        // The same reads through paths compiled once
+        {
+            const JsonPath id( "id" ), name( "name" ), score( "score" ), active( "active" ), tags( "tags" ),
+                           bio( "bio" ), lat( "geo.lat" ), note( "/geo/note" );
+            report( "JsonPath::find", doc.size(), [&]() {
+                std::size_t hits = 0;
+                for( const auto& rec : parsed ) {
+                    hits += id.get( rec ).isInt() + name.get( rec ).isString() + score.get( rec ).isDouble()
+                          + active.get( rec ).isBool() + tags.get( rec ).isArray() + bio.get( rec ).isString()
+                          + lat.get( rec ).isDouble() + note.exists( rec );
+                }
+                if( hits == 0 ) std::printf( "no fields\n" );
+            });
+        }
+
+        // The same reads on the tape representation
+        const TapeDocument tape = Parser::parseTape( doc );
+        report( "TapeView::operator[] (key)", doc.size(), [&]() {
+            std::size_t hits = 0;
+            for( const TapeView rec : tape.root() ) {
+                hits += rec["id"].isInt() + rec["name"].isString() + rec["score"].isDouble()
+                      + rec["active"].isBool() + rec["tags"].isArray() + rec["bio"].isString()
+                      + rec["geo"]["lat"].isDouble() + rec["geo"].contains( "note" );
+            }
+            if( hits == 0 ) std::printf( "no fields\n" );
+        });
+
+        // Copy the whole document and change one field of one record: only
+        // the path down to that field is copied
+        report( "Json copy + one write", doc.size(), [&]() {
+            Json copy = parsed;
+            copy[0]["name"] = "changed";
+            if( copy.size() != parsed.size() ) std::printf( "size mismatch\n" );
+        });
+
+        std::printf( "[ Builder ]\n" );
+
+        // The bench records built in code: children filled in place, nothing
+        // copied after construction (bytes: the serialized output)
+        const std::size_t records = parsed.size();
+        report( "Json build (emplace)", outSize, [&]() {
+            Json out = JsonArray();
+            out.reserve( records );
+            for( std::size_t i = 0; i < records; ++i ) {
+                Json& rec = out.emplaceBack( JsonType::OBJECT );
+                rec.reserve( 7 );
+                rec.emplace( "id", static_cast<long long>( i ) );
+                rec.emplace( "name", "user_" + std::to_string( i ) );
+                rec.emplace( "score", ( i % 1000 ) + ( i % 97 ) / 100.0 );
+                rec.emplace( "active", i % 2 == 1 );
+                rec.emplace( "tags", JsonArray( { "alpha", "beta", "gamma" } ) );
+                rec.emplace( "geo", JsonObject( { { "lat", 37.5665 }, { "lng", 126.978 }, { "note", JsonNULL() } } ) );
+                rec.emplace( "bio", "line one\nline \"two\"" );
+            }
+            if( out.size() != records ) std::printf( "size mismatch\n" );
+        });
+    }
+    catch( const TinyJsonException& e ) {
+        std::cerr << "[TinyJson Error] " << e.what() << std::endl;
+        return -1;
+    }
+
+    return 0;
+}
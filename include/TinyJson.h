@@ -13,12 +13,18 @@
  */
 
 #include <string>
+#include <cstring> // for std::strlen, std::memcmp
+#include <cstdint>
 #include <vector>
+#include <initializer_list>
 #include <unordered_map>
 #include <sstream>
 #include <exception>
 #include <type_traits>
 #include <utility> // for std::pair, std::move
+#include <memory>
+#include <functional>
+#include <atomic>
 
 namespace TinyJson {
 
@@ -44,6 +50,15 @@ private:
 // =============================================================================
 
 class Json;
+class JsonHandler;
+class StreamParser;
+class JsonView;
+class ViewDocument;
+class Document;
+class TapeDocument;
+class TapeView;
+class JsonPath;
+class StringPool;
 
 /**
  * @brief Represents the data type of a JSON element.
@@ -67,13 +82,266 @@ enum class ToStringType {
     Pretty  ///< Formatted string (indented)
 };
 
-using JsonObjects = std::vector<std::pair<std::string, Json>>;
+class SharedString;
+using JsonObjects = std::vector<std::pair<SharedString, Json>>;
 using JsonArrays  = std::vector<Json>;
 
+// =============================================================================
+// [StringView Class]
+// =============================================================================
+
+/**
+ * @brief Non-owning reference to a character range (C++14 stand-in for
+ * std::string_view). The referenced memory must outlive the view.
+ */
+class StringView
+{
+public:
+    StringView() noexcept : ptr( "" ), len( 0 ) {}
+    StringView( const char* s ) noexcept : ptr( s ), len( std::strlen( s ) ) {}
+    StringView( const char* s, std::size_t n ) noexcept : ptr( s ), len( n ) {}
+    StringView( const std::string& s ) noexcept : ptr( s.data() ), len( s.size() ) {}
+
+    const char* data()  const noexcept { return ptr; }
+    std::size_t size()  const noexcept { return len; }
+    bool        empty() const noexcept { return len == 0; }
+
+    const char* begin() const noexcept { return ptr; }
+    const char* end()   const noexcept { return ptr + len; }
+
+    char operator[]( std::size_t i ) const noexcept { return ptr[i]; }
+
+    std::string toString() const { return std::string( ptr, len ); }
+    explicit operator std::string() const { return toString(); }
+
+    // operator override : compare
+    friend bool operator==( StringView a, StringView b ) noexcept
+    {
+        return a.len == b.len && ( a.len == 0 || std::memcmp( a.ptr, b.ptr, a.len ) == 0 );
+    }
+    friend bool operator!=( StringView a, StringView b ) noexcept { return !( a == b ); }
+
+    // operator override : stream
+    friend std::ostream& operator<<( std::ostream& os, StringView v )
+    {
+        return os.write( v.ptr, static_cast<std::streamsize>( v.len ) );
+    }
+
+private:
+    const char* ptr;
+    std::size_t len;
+};
+
+// =============================================================================
+// [SharedString & StringPool Classes]
+// =============================================================================
+
+/**
+ * @brief Immutable, reference-counted string: copies share one buffer.
+ * Object keys are stored as SharedStrings, so every occurrence of a key
+ * interned in the same pool is one allocation, and equal interned keys
+ * compare by pointer. Counts are atomic; copies may cross threads.
+ */
+class SharedString
+{
+public:
+    SharedString() noexcept : rep( nullptr ) {}
+    explicit SharedString( StringView text );
+
+    SharedString( const SharedString& other ) noexcept : rep( retain( other.rep ) ) {}
+    SharedString( SharedString&& other ) noexcept : rep( other.rep ) { other.rep = nullptr; }
+    ~SharedString() { release( this->rep ); }
+
+    SharedString& operator=( SharedString other ) noexcept
+    {
+        std::swap( this->rep, other.rep );
+        return ( *this );
+    }
+
+    const char* data()  const noexcept { return this->rep ? this->rep->text : ""; }
+    std::size_t size()  const noexcept { return this->rep ? this->rep->size : 0; }
+    bool        empty() const noexcept { return this->size() == 0; }
+
+    StringView  view() const noexcept { return StringView( this->data(), this->size() ); }
+    std::string str()  const { return std::string( this->data(), this->size() ); }
+    operator StringView() const noexcept { return this->view(); }
+
+    /** @brief True if both share one buffer (always the case for equal pooled strings). */
+    bool sameAs( const SharedString& other ) const noexcept { return this->rep == other.rep; }
+
+    friend bool operator==( const SharedString& a, const SharedString& b ) noexcept
+    {
+        return a.rep == b.rep || a.view() == b.view();
+    }
+    friend bool operator!=( const SharedString& a, const SharedString& b ) noexcept { return !( a == b ); }
+
+    friend std::ostream& operator<<( std::ostream& os, const SharedString& s ) { return os << s.view(); }
+
+private:
+    friend class Json;
+    friend class Parser;
+
+    struct Rep {
+        std::atomic<uint32_t> refs;
+        uint32_t              size;
+        char                  text[1]; // size + 1 bytes, null-terminated
+    };
+
+    explicit SharedString( Rep* r ) noexcept : rep( r ) {}
+    Rep* detach() noexcept { Rep* r = this->rep; this->rep = nullptr; return r; }
+
+    // Unescapes JSON string contents into a new buffer
+    static SharedString decode( const char* s, std::size_t n, bool escaped );
+    static Rep* allocate( std::size_t size );
+
+    static Rep* retain( Rep* r ) noexcept
+    {
+        if( r ) r->refs.fetch_add( 1, std::memory_order_relaxed );
+        return r;
+    }
+    static void release( Rep* r ) noexcept
+    {
+        if( r && r->refs.fetch_sub( 1, std::memory_order_acq_rel ) == 1 )
+            ::operator delete( r );
+    }
+
+    Rep* rep;
+};
+
+/**
+ * @brief Thread-safe intern pool: equal text always yields the same
+ * SharedString. Pass one to a parse (ParseOptions::pool) to share keys
+ * across documents. Interned strings stay valid after the pool is
+ * cleared or destroyed; the pool only holds one more reference.
+ */
+class StringPool
+{
+public:
+    StringPool();
+    ~StringPool();
+
+    StringPool( const StringPool& )            = delete;
+    StringPool& operator=( const StringPool& ) = delete;
+
+    SharedString intern( StringView text );
+
+    /** @brief Number of distinct strings held. */
+    std::size_t size() const;
+
+    /** @brief Drops the pool's references; strings in use are unaffected. */
+    void clear();
+
+private:
+    struct Impl; // defined in TinyJson.cpp
+    std::unique_ptr<Impl> impl;
+};
+
+// =============================================================================
+// [JsonHandler Class (SAX)]
+// =============================================================================
+
+/**
+ * @brief Event interface for Parser::parse( text, handler ).
+ * The parser reports each token in document order without building a Json
+ * tree. Override only the events you need; every default accepts the event.
+ * Returning false from any event stops parsing early.
+ *
+ * StringViews passed to string() and key() are valid only during the call.
+ */
+class JsonHandler
+{
+public:
+    virtual ~JsonHandler() = default;
+
+    virtual bool startObject()            { return true; }
+    virtual bool key( StringView )        { return true; }
+    virtual bool endObject()              { return true; }
+
+    virtual bool startArray()             { return true; }
+    virtual bool endArray()               { return true; }
+
+    virtual bool string( StringView )     { return true; } ///< Escapes already decoded
+    virtual bool integer( int64_t )       { return true; } ///< Integers that fit in int64
+    virtual bool number( double )         { return true; } ///< Fractions, exponents, huge integers
+    virtual bool boolean( bool )          { return true; }
+    virtual bool null()                   { return true; }
+};
+
 // =============================================================================
 // [Parser Class]
 // =============================================================================
 
+/**
+ * @brief Why Parser::tryParse rejected its input.
+ */
+enum class ParseError : uint8_t {
+    None,
+    UnexpectedEnd,        ///< input ended where a value was expected
+    InvalidCharacter,     ///< not the start of a JSON value
+    InvalidNumber,
+    LeadingZero,          ///< e.g. 012
+    MissingFraction,      ///< no digit after '.'
+    MissingExponent,      ///< no digit after 'e'
+    InvalidEscape,
+    InvalidUnicodeEscape, ///< \u not followed by four hex digits
+    ControlCharacter,     ///< raw byte below 0x20 inside a string
+    UnterminatedString,
+    ExpectedKey,
+    ExpectedColon,
+    ExpectedObjectEnd,    ///< expected ',' or '}'
+    ExpectedArrayEnd,     ///< expected ',' or ']'
+    MismatchedBrackets,
+    TrailingCharacters,   ///< more input after the root value
+    DepthExceeded,        ///< see ParseOptions::maxDepth
+    InvalidUtf8,          ///< see ParseOptions::validateUtf8
+    InputTooLarge,        ///< 4 GiB or more
+    DocumentTooLarge,     ///< beyond a TapeDocument limit (see TapeDocument)
+    OutOfMemory
+};
+
+/**
+ * @brief Outcome of Parser::tryParse: an error code and where it occurred.
+ */
+struct ParseResult
+{
+    ParseError  error  = ParseError::None;
+    std::size_t offset = 0; ///< byte offset of the error
+    std::size_t line   = 0; ///< 1-based line of `offset`
+    std::size_t column = 0; ///< 1-based column of `offset`, in bytes
+
+    /// true on success
+    explicit operator bool() const noexcept { return error == ParseError::None; }
+
+    /// Description of `error` (the text used by TinyJsonException)
+    const char* message() const noexcept;
+};
+
+/**
+ * @brief Optional checks for Parser::parse / Parser::parseFile. Every other
+ * entry point (SAX, in-situ, tape, lazy, parallel, JSON Lines and
+ * StreamParser) takes the same options.
+ */
+struct ParseOptions
+{
+    /// Reject input that is not well-formed UTF-8 (overlong forms,
+    /// surrogates and truncated sequences included). The check runs in
+    /// the same pass that indexes the input.
+    bool validateUtf8 = false;
+
+    /// Deepest nesting of objects and arrays accepted (the root container
+    /// is depth 1); deeper input fails with "Maximum nesting depth exceeded".
+    std::size_t maxDepth = 1024;
+
+    /// Object keys are always shared within one document. With a pool
+    /// they are interned there instead, and shared with every document
+    /// parsed against the same pool (from any thread).
+    StringPool* pool = nullptr;
+
+    /// String values of at most this many bytes are interned like keys
+    /// (enum-like fields such as "active" or "EUR"); 0 interns none.
+    std::size_t internValueLength = 0;
+};
+
 /**
  * @brief Static helper class for parsing JSON strings and files.
  */
@@ -96,49 +364,201 @@ public:
      */
     static Json parse( const std::string& str );
 
+    /**
+     * @brief Parses a JSON text of known length into a Json object.
+     * The buffer does not need to be null-terminated.
+     * @param data   Pointer to the first byte of the JSON text.
+     * @param length Number of bytes to parse.
+     * @return Parsed Json object.
+     * @throws TinyJsonException if parsing fails.
+     */
+    static Json parse( const char* data, std::size_t length );
+
     /**
      * @brief Reads a JSON file and parses it.
+     * Regular files are memory-mapped (POSIX) and parsed directly from the
+     * mapping; other files are read once into a pre-sized buffer.
      * @param fileName Path to the JSON file.
      * @return Parsed Json object.
      * @throws TinyJsonException if file open fails or parsing errors occur.
      */
     static Json parseFile( const std::string& fileName );
 
-    // -------------------------------------------------------------------------
-    // Utility Methods
-    // -------------------------------------------------------------------------
-    static bool isObject( const char* str ) noexcept;
-    static bool isObject( const std::string& str ) noexcept;
+    /**
+     * @brief parse() / parseFile() with extra checks.
+     * @param options See ParseOptions.
+     * @throws TinyJsonException if parsing fails or a check rejects the input.
+     */
+    static Json parse( StringView text, const ParseOptions& options );
+    static Json parseFile( const std::string& fileName, const ParseOptions& options );
 
-private:
-    enum class TokenType {
-        UNKNOWN,
-        STRING, INT, DOUBLE, BOOLEAN, // real data types
-        CBRACE_OPEN, CBRACE_CLOSE,    // { }
-        BRACKET_OPEN, BRACKET_CLOSE,  // [ ]
-        COMMA, COLON,                 // , :
-        NULL_TYPE
-    };
+    /**
+     * @brief Parses JSON text without throwing: malformed input is reported
+     * through the result instead of an exception.
+     * @param text    JSON text.
+     * @param out     Receives the parsed value; left unchanged on failure.
+     * @param options See ParseOptions.
+     * @return Success, or the error with its byte offset, line and column.
+     */
+    static ParseResult tryParse( StringView text, Json& out, const ParseOptions& options = ParseOptions() ) noexcept;
 
-    struct Token {
-        // constructor
-        Token( std::string _value = "", TokenType _type = TokenType::UNKNOWN )
-            : value( _value ), type( _type )
-        {}
+    /**
+     * @brief Parses a mutable buffer in place, without copying any text.
+     * String values and keys become StringViews into `buffer`: escape
+     * sequences are decoded in place and each string is null-terminated
+     * where its closing quote was. The buffer is modified and must outlive
+     * the returned document.
+     * @param buffer  Caller-owned JSON text (need not be null-terminated).
+     * @param length  Number of bytes to parse.
+     * @param options See ParseOptions (the pool settings do not apply).
+     * @return Read-only document viewing `buffer`.
+     * @throws TinyJsonException if parsing fails.
+     */
+    static ViewDocument parseInSitu( char* buffer, std::size_t length, const ParseOptions& options = ParseOptions() );
 
-        // members
-        std::string value;
-        TokenType   type;
-    };
+    /**
+     * @brief Parses JSON text into a frozen, read-only TapeDocument: one
+     * contiguous array of 64-bit words plus one string buffer, instead of
+     * a node allocation per value. The input is not referenced afterwards.
+     * @param text    JSON text.
+     * @param options See ParseOptions (the pool settings do not apply).
+     * @return The document; read it through TapeDocument::root().
+     * @throws TinyJsonException if parsing fails.
+     */
+    static TapeDocument parseTape( StringView text, const ParseOptions& options = ParseOptions() );
+
+    /**
+     * @brief parseTape() without exceptions.
+     * @param out Receives the document; left unchanged on failure.
+     */
+    static ParseResult tryParse( StringView text, TapeDocument& out, const ParseOptions& options = ParseOptions() ) noexcept;
+
+    /**
+     * @brief Parses JSON text into a lazily built Json tree.
+     * The whole text is validated up front, but only the byte extent of
+     * each object and array is recorded. A container's members are built
+     * the first time it is accessed (operator[], begin(), size(), ...);
+     * nested containers stay unparsed until they are reached in turn.
+     * The returned tree keeps the text alive and behaves like an eagerly
+     * parsed one, except that concurrent reads of a not-yet-built
+     * subtree must be synchronized by the caller.
+     * @param text    JSON text (moved into the document).
+     * @param options See ParseOptions; checked up front, over the whole text
+     *                (the pool settings do not apply).
+     * @return Parsed Json object.
+     * @throws TinyJsonException if parsing fails.
+     */
+    static Json parseLazy( std::string text, const ParseOptions& options = ParseOptions() );
+    static Json parseLazy( const char* data, std::size_t length, const ParseOptions& options = ParseOptions() );
+
+    /**
+     * @brief Parses JSON text and reports it to `handler` event by event
+     * (SAX style). No Json nodes are created.
+     * @param data    Pointer to the first byte of the JSON text.
+     * @param length  Number of bytes to parse.
+     * @param handler Receives the events; may stop parsing by returning false.
+     * @param options See ParseOptions (the pool settings do not apply).
+     * @return false if the handler stopped parsing, true otherwise.
+     * @throws TinyJsonException if parsing fails. Exceptions thrown by the
+     * handler propagate unchanged.
+     */
+    static bool parse( const char* data, std::size_t length, JsonHandler& handler,
+                       const ParseOptions& options = ParseOptions() );
+    static bool parse( const std::string& str, JsonHandler& handler, const ParseOptions& options = ParseOptions() );
+
+    /**
+     * @brief Parses a document whose root is a (large) array on several
+     * threads. A fast structural scan finds top-level element boundaries,
+     * the elements are split into chunks that are parsed concurrently into
+     * a pre-sized array, and the result is identical to parse(). Small
+     * inputs and non-array roots are parsed on the calling thread.
+     * Unlike parse(), the array itself may exceed 4 GiB.
+     * @param text    The whole JSON text.
+     * @param threads Worker count; 0 uses std::thread::hardware_concurrency().
+     * @param options See ParseOptions.
+     * @return Parsed Json object.
+     * @throws TinyJsonException if parsing fails.
+     */
+    static Json parseParallel( StringView text, unsigned threads = 0, const ParseOptions& options = ParseOptions() );
+    static Json parseFileParallel( const std::string& fileName, unsigned threads = 0,
+                                   const ParseOptions& options = ParseOptions() );
+
+    // -------------------------------------------------------------------------
+    // JSON Lines (NDJSON)
+    // -------------------------------------------------------------------------
 
-    inline static bool isWhiteSpace( const char c );
+    /// Receives each record of a JSON Lines input, in input order
+    using RecordCallback = std::function<void( Json&& )>;
+
+    /**
+     * @brief Parses newline-delimited JSON (one value per line) on a pool of
+     * worker threads. Lines are cut into batches that are parsed in parallel
+     * and then delivered in input order. Blank lines are skipped.
+     * @param text    The whole input (a std::string, a C string, or
+     *                StringView( data, length ) for a raw buffer).
+     * @param threads Worker count; 0 uses std::thread::hardware_concurrency().
+     * @param options See ParseOptions; applied to each line.
+     * @return One Json per non-blank line, in input order.
+     * @throws TinyJsonException for the first malformed line (with its line number).
+     */
+    static std::vector<Json> parseLines( StringView text, unsigned threads = 0,
+                                         const ParseOptions& options = ParseOptions() );
+    static std::vector<Json> parseLines( std::istream& in, unsigned threads = 0,
+                                         const ParseOptions& options = ParseOptions() );
+    static std::vector<Json> parseLinesFile( const std::string& fileName, unsigned threads = 0,
+                                             const ParseOptions& options = ParseOptions() );
 
-    static int nextWhiteSpace ( const std::string& src, const int startPos ) noexcept;
-    static int skipWhiteSpaces( const std::string& src, const int pos      ) noexcept;
+    /**
+     * @brief Callback variants: each record is handed to `onRecord` on the
+     * calling thread, in input order, as soon as its batch is parsed. Only a
+     * bounded window of batches is held in memory, so inputs larger than RAM
+     * can be processed from a stream.
+     */
+    static void parseLines( StringView text, const RecordCallback& onRecord, unsigned threads = 0,
+                            const ParseOptions& options = ParseOptions() );
+    static void parseLines( std::istream& in, const RecordCallback& onRecord, unsigned threads = 0,
+                            const ParseOptions& options = ParseOptions() );
+    static void parseLinesFile( const std::string& fileName, const RecordCallback& onRecord, unsigned threads = 0,
+                                const ParseOptions& options = ParseOptions() );
 
-    static std::vector<Token> tokenize( const std::string& src );
+    // -------------------------------------------------------------------------
+    // Utility Methods
+    // -------------------------------------------------------------------------
+    /**
+     * @brief True if `str` is one complete JSON value (blank text is not).
+     * Only validates: nothing is built and nothing is allocated.
+     */
+    static bool isObject( const char* str ) noexcept;
+    static bool isObject( const std::string& str ) noexcept;
 
-    static Json jsonParse( const std::vector<Token>& v, int& curPos );
+private:
+    friend class StreamParser;
+    friend class Document;
+
+    // Two stages: a vectorized pass indexes every structural byte, then a
+    // non-recursive descent (with an explicit container stack) walks that
+    // index and reports each value to a Builder, which turns them into
+    // Json nodes, ViewDocument nodes or JsonHandler events.
+    struct Cursor;      // defined in TinyJson.cpp
+    class  DomBuilder;  // builds a Json tree
+    class  ViewBuilder; // builds a ViewDocument over the input buffer
+    class  SaxBuilder;  // forwards events to a JsonHandler
+    class  LazyBuilder; // records container extents for parseLazy
+    class  TapeBuilder; // writes a TapeDocument
+    class  KeyCache;    // interns the keys of one parse
+
+    // Syntax errors are returned (recorded in the Cursor), not thrown
+    template <typename Builder> static ParseResult parseDocument( const char* data, std::size_t length, Builder& b,
+                                                                  const ParseOptions& options = ParseOptions() );
+    template <typename Builder> static bool parseValue ( Cursor& cur, Builder& b );
+    template <typename Builder> static bool parseScalar( Cursor& cur, Builder& b );
+    template <typename Builder> static bool parseKey   ( Cursor& cur, Builder& b );
+
+    static void parseElements( const char* data, std::size_t length, std::size_t base, Json* out, std::size_t count,
+                               const ParseOptions& options );
+
+    static bool scanString( Cursor& cur, const char*& str, std::size_t& len, bool& escaped );
+    static bool scanNumber( Cursor& cur, const char*& str, std::size_t& len, JsonType& type );
 };
 
 // =============================================================================
@@ -151,6 +571,7 @@ private:
 class Json
 {
     friend class Parser;
+    friend class JsonPath;
 
 public:
     // Forward declarations for iterators
@@ -173,6 +594,7 @@ public:
 
         // operator override : type cast
         operator std::string() const { return keyStr; }
+        operator StringView()  const { return StringView( keyStr ); }
         operator size_t()      const { return indexVal; }
         operator int()         const { return static_cast<int>( indexVal ); }
 
@@ -250,7 +672,7 @@ public:
                 return JsonKey( std::to_string( idx ), idx, true );
             }
             // Object
-            return JsonKey( objIt->first, 0, false );
+            return JsonKey( objIt->first.str(), 0, false );
         }
 
         reference value() const { return operator*(); }
@@ -323,7 +745,7 @@ public:
                 return JsonKey( std::to_string( idx ), idx, true );
             }
             // Object
-            return JsonKey( objIt->first, 0, false );
+            return JsonKey( objIt->first.str(), 0, false );
         }
 
         reference value() const { return operator*(); }
@@ -406,7 +828,7 @@ public:
     // =========================================================================
     // [Constructors & Destructor]
     // =========================================================================
-    Json( const JsonType type ) noexcept;
+    Json( const JsonType type );
 
     // String
     Json( const char* initVal );
@@ -414,16 +836,25 @@ public:
     Json( char initVal );
 
     // Numeric
-    Json( int       initVal );
-    Json( long      initVal );
-    Json( long long initVal );
-    Json( double    initVal );
-    Json( float     initVal );
+    Json( int                initVal );
+    Json( long               initVal );
+    Json( long long          initVal );
+    Json( unsigned int       initVal );
+    Json( unsigned long      initVal );
+    Json( unsigned long long initVal );
+    Json( double             initVal );
+    Json( float              initVal );
 
     // Boolean
     Json( bool initVal ) noexcept;
 
     // Copy & Move
+    // Copies are O(1): objects and arrays are shared and copied on first
+    // modification through a non-const accessor. A container that has handed
+    // out a reference or iterator (const or not) is copied right away
+    // instead, so references taken before a copy neither reach the copy nor
+    // move when their owner is modified. References taken while a copy
+    // already shares the container follow the container, not the owner.
     Json( const Json& other );
     Json( Json&& other ) noexcept;
 
@@ -438,16 +869,38 @@ public:
 
     // Assignment operators for value setting
     Json& operator=( const int value );
+    Json& operator=( const long value );
+    Json& operator=( const long long value );
+    Json& operator=( const unsigned int value );
+    Json& operator=( const unsigned long value );
+    Json& operator=( const unsigned long long value );
     Json& operator=( const double value );
-    Json& operator=( const std::string& value );
+    Json& operator=( const std::string& value ); // valid JSON text is parsed, see assignString
     Json& operator=( const char* value );
     Json& operator=( const bool value );
 
-    // Access operators
+    /**
+     * @brief Replaces this value with the one described by JSON text.
+     * The text is parsed once; on error this value is left unchanged.
+     * @throws TinyJsonException if `text` is not valid JSON.
+     */
+    Json& assignJson( StringView text );
+
+    /**
+     * @brief Stores `value` as a string as-is. Unlike operator=, the text is
+     * never interpreted as JSON and costs no parse attempt.
+     */
+    Json& assignString( StringView value );
+
+    // Access operators. Keys are taken as StringView (std::string, a
+    // literal, or StringView( data, length ) for a slice of a buffer): a
+    // lookup neither allocates nor copies the key.
     Json& operator[]( const int arrIdx );
-    Json& operator[]( const std::string& key );
+    Json& operator[]( StringView key );
+    Json& operator[]( const char* key ) { return ( *this )[StringView( key )]; }
     const Json& operator[]( const int arrIdx ) const;
-    const Json& operator[]( const std::string& key ) const;
+    const Json& operator[]( StringView key ) const;
+    const Json& operator[]( const char* key ) const { return ( *this )[StringView( key )]; }
 
     // =========================================================================
     // [Type Checks]
@@ -466,10 +919,10 @@ public:
     // =========================================================================
     /**
      * @brief Checks if a specific key exists in the JSON object.
-     * @param key The key to search for.
+     * @param key The key to search for (not copied).
      * @return true if the key exists, false otherwise (or if not an object).
      */
-    bool contains( const std::string& key ) const;
+    bool contains( StringView key ) const;
 
     // =========================================================================
     // [Value Accessors]
@@ -477,7 +930,11 @@ public:
 
     /**
      * @brief Converts the JSON value to a specific C++ type.
-     * @tparam T Target type (int, double, bool, std::string).
+     * Numbers are stored natively (int64, uint64 or double) when the node is
+     * built, so numeric reads do not parse text. Integer targets throw
+     * TinyJsonException if the value does not fit.
+     * @tparam T Target type (int, long, long long and their unsigned
+     *           forms, double, bool, std::string).
      */
     template <typename T> T getAs() const;
 
@@ -488,9 +945,11 @@ public:
     template <typename T>
     bool tryGetAs( T& ref ) const
     {
+        const bool isInteger = std::is_integral<T>::value && !std::is_same<T, bool>::value;
+
         if( ( std::is_same<T, std::string>::value && this->isString() ) ||
             ( std::is_same<T, double>::value      && this->isDouble() ) ||
-            ( std::is_same<T, int>::value         && this->isInt()    ) ||
+            ( isInteger                           && this->isInt()    ) ||
             ( std::is_same<T, bool>::value        && this->isBool()   ) )
         {
             try {
@@ -509,9 +968,11 @@ public:
 
     /**
      * @brief Serializes the JSON object to a string.
-     * @param type ToStringType::Strip (default) or ToStringType::Pretty.
+     * @param type      ToStringType::Strip (default) or ToStringType::Pretty.
+     * @param asciiOnly Escape every non-ASCII character as \uXXXX (UTF-16
+     *                  surrogate pairs above U+FFFF) so the output is 7-bit.
      */
-    std::string toString( ToStringType type = ToStringType::Strip ) const noexcept;
+    std::string toString( ToStringType type = ToStringType::Strip, bool asciiOnly = false ) const noexcept;
 
     /**
      * @brief Saves the JSON object to a file.
@@ -525,44 +986,75 @@ public:
     /**
      * @brief Adds a Key-Value pair (Object) or an Element (Array).
      * Automatically adapts based on the current JSON type (Object/Array).
+     * Rvalues (including Json temporaries) are moved into place.
      */
     template <typename T>
-    Json& addObject( const std::string& key, const T& value )
+    Json& addObject( StringView key, T&& value )
     {
         if( this->jType == JsonType::ARRAY ){
             Json tempObj = Json( JsonType::OBJECT );
-            tempObj.addProperty( key, Json( value ) );
-            this->addElement( tempObj );
+            tempObj.addProperty( key, Json( std::forward<T>( value ) ) );
+            this->addElement( std::move( tempObj ) );
         } else {
             this->setType( JsonType::OBJECT );
-            this->addProperty( key, Json( value ) );
+            this->addProperty( key, Json( std::forward<T>( value ) ) );
         }
         return ( *this );
     }
 
     /**
      * @brief Adds a JSON object (Merge for Object, Push for Array).
+     * The rvalue form moves the members instead of copying them.
      */
     Json& addObject( const Json& objectValue );
+    Json& addObject( Json&& objectValue );
 
     /**
-     * @brief Adds multiple elements to an Array.
+     * @brief Adds multiple elements to an Array. Rvalues are moved into place.
      */
-    template <typename T, typename... Types>
-    Json& addElementToArray( const T& element, Types... elements )
+    template <typename... Types>
+    Json& addElementToArray( Types&&... elements )
     {
-        this->addElement( Json( element ) );
-        this->addElementToArray( elements... );
+        this->setType( JsonType::ARRAY );
+
+        // Braced initializers are evaluated left to right
+        int expand[] = { 0, ( this->addElement( Json( std::forward<Types>( elements ) ) ), 0 )... };
+        (void)expand;
         return ( *this );
     }
 
-    template <typename T>
-    Json& addElementToArray( const T& element )
+    /**
+     * @brief Constructs a new element at the end of the Array from `args`
+     * (any Json constructor argument, e.g. JsonType::OBJECT) and returns it,
+     * so nested values can be filled in place instead of built and copied.
+     * The reference is valid until the next element is added.
+     */
+    template <typename... Args>
+    Json& emplaceBack( Args&&... args )
     {
-        this->addElement( Json( element ) );
-        return ( *this );
+        return this->leak( this->addElement( Json( std::forward<Args>( args )... ) ) );
+    }
+
+    /**
+     * @brief Object counterpart of emplaceBack: constructs the value of `key`
+     * from `args` (replacing an existing one) and returns it.
+     * The reference is valid until the next member is added.
+     */
+    template <typename... Args>
+    Json& emplace( StringView key, Args&&... args )
+    {
+        return this->leak( this->addProperty( key, Json( std::forward<Args>( args )... ) ) );
     }
 
+    /**
+     * @brief Reserves room for `count` elements (Array) or members (Object),
+     * so that filling a container of known size does not reallocate.
+     * Like std::vector::reserve, reserving only a little more than the
+     * current size on every insertion defeats geometric growth.
+     * Other types are left unchanged.
+     */
+    Json& reserve( std::size_t count );
+
     // =========================================================================
     // [Iteration Methods]
     // =========================================================================
@@ -578,35 +1070,90 @@ public:
 private:
     Json() noexcept; // Default constructor hidden
 
-    std::string strValue;
-    JsonType    jType;
-    JsonObjects properties;
-    JsonArrays  arr;
-    std::unordered_map<std::string, std::size_t> mapIndex;
-
-    // Private Helpers
-    std::string makeSpace( const unsigned int space ) const noexcept;
+    // A node is a type tag and one 8-byte payload: numbers and booleans are
+    // stored inline, strings and containers behind a single pointer, so a
+    // scalar costs no allocation beyond its slot in the parent. Strings
+    // are shared (one reference to a SharedString buffer, null when empty);
+    // numbers beyond the native range (INT over 64 bits, DOUBLE over the
+    // double range) keep their source text in `str` (Text).
+    enum class NumberKind : uint8_t { Int64, UInt64, Double, Text };
+    struct Container;
+    union Payload {
+        int64_t            i;
+        uint64_t           u;
+        double             d;
+        bool               b;
+        SharedString::Rep* str; // STRING, INT / DOUBLE (Text)
+        Container*         box; // OBJECT, ARRAY
+    };
+    Payload    val;
+    JsonType   jType;
+    NumberKind numKind = NumberKind::Int64;
+
+    // Lazy nodes (see Parser::parseLazy) build their container on first
+    // access, which may happen through a const path.
+    struct LazySource;
+    void load() const;
+    void materialize() const;
+
+    // Copy-on-write: the container, copied first if other values share it
+    Container& unshare();
+    // unshare() for accessors returning a reference or iterator into it:
+    // the container is never shared again (see Json( const Json& ))
+    Container&       leak();
+    const Container& leak() const;        // marks without copying
+    Json&            leak( Json& child ); // marks this container, returns `child`
+
+    bool ownsString() const noexcept
+    {
+        return this->jType == JsonType::STRING
+            || ( ( this->jType == JsonType::INT || this->jType == JsonType::DOUBLE ) && this->numKind == NumberKind::Text );
+    }
 
-    std::string toStringPretty( const unsigned int space ) const noexcept;
-    std::string toStringStrip() const noexcept;
+    StringView text() const noexcept
+    {
+        return this->val.str ? StringView( this->val.str->text, this->val.str->size ) : StringView();
+    }
 
-    static std::string deserialize( const std::string& src ) noexcept;
-    static std::string serialize  ( const std::string& src ) noexcept;
+    // Private Helpers: append this value's JSON text to `out`
+    void writePretty( std::string& out, const unsigned int space, bool asciiOnly ) const;
+    void writeStrip ( std::string& out, bool asciiOnly ) const;
 
     // Low-level manipulators
+    void  reset( const JsonType type ); // frees the payload, then starts empty
     Json& setType( const JsonType type );
+    void  setBoolean( bool v ) noexcept;
+    void  setNumber( const char* s, std::size_t n, JsonType type ); // from JSON text
+    void  setInteger ( int64_t  v );
+    void  setUnsigned( uint64_t v );
+    void  setDouble  ( double   v );
+    template <typename T> T integerValue() const;
+    void  appendNumber( std::string& out ) const;
+    std::string numberText() const;
     void  setString( const std::string& s ) noexcept;
-    void  addProperty( const std::string& key, const Json& value );
-    void  addElement( const Json& value );
+    void  adoptString( SharedString s ) noexcept; // STRING node sharing `s`
+    Json& assignText( StringView text );          // operator= for text: JSON is parsed, see assignString
+    // Each returns the stored value
+    Json& addProperty( StringView key, Json&& value ) { return this->addProperty( key, nullptr, std::move( value ) ); }
+    Json& addProperty( StringView key, const SharedString* shared, Json&& value ); // reuses `shared` if given
+    Json& addElement( Json&& value );
 };
 
+// Documents of millions of scalars are arrays of these slots; keep them small.
+static_assert( sizeof( Json ) <= 16, "Json must stay a tag plus an 8-byte payload" );
+
 // =============================================================================
 // [Template Specializations]
 // =============================================================================
-template <> int         Json::getAs<int>()         const;
-template <> double      Json::getAs<double>()      const;
-template <> std::string Json::getAs<std::string>() const;
-template <> bool        Json::getAs<bool>()        const;
+template <> int                Json::getAs<int>()                const;
+template <> long               Json::getAs<long>()               const;
+template <> long long          Json::getAs<long long>()          const;
+template <> unsigned int       Json::getAs<unsigned int>()       const;
+template <> unsigned long      Json::getAs<unsigned long>()      const;
+template <> unsigned long long Json::getAs<unsigned long long>() const;
+template <> double             Json::getAs<double>()             const;
+template <> std::string        Json::getAs<std::string>()        const;
+template <> bool               Json::getAs<bool>()               const;
 
 // =============================================================================
 // [Global Helper Functions]
@@ -617,36 +1164,714 @@ Json JsonObject();
 
 /** @brief Creates a JSON Object with an initial key-value pair. */
 template <typename T>
-Json JsonObject( const std::string& key, const T& value )
+Json JsonObject( StringView key, T&& value )
 {
-    return JsonObject().addObject( key, value );
+    return JsonObject().addObject( key, std::forward<T>( value ) );
 }
 
 /** @brief Specialization for C-string to prevent bool conversion issues. */
-inline Json JsonObject( const std::string& key, const char* value )
+inline Json JsonObject( StringView key, const char* value )
 {
     return JsonObject().addObject( key, std::string( value ) );
 }
 
+/**
+ * @brief Creates a JSON Object from a literal list of members:
+ * JsonObject( { { "id", 1 }, { "tags", JsonArray( { "a", "b" } ) } } ).
+ */
+Json JsonObject( std::initializer_list<std::pair<std::string, Json>> members );
+
 /** @brief Creates an empty JSON Array. */
 Json JsonArray();
 
 /** @brief Creates a JSON Array with initial elements. */
 template <typename T, typename... Types>
-Json JsonArray( const T& element, Types... elements )
+Json JsonArray( T&& element, Types&&... elements )
 {
-    return JsonArray().addElementToArray( element, elements... );
+    return JsonArray().addElementToArray( std::forward<T>( element ), std::forward<Types>( elements )... );
 }
 
-template <typename T>
-Json JsonArray( const T& element )
-{
-    return JsonArray().addElementToArray( element );
-}
+/** @brief Creates a JSON Array from a literal list: JsonArray( { 1, "two", 3.0 } ). */
+Json JsonArray( std::initializer_list<Json> elements );
 
 /** @brief Creates a JSON Null. */
 Json JsonNULL();
 
+// =============================================================================
+// [JsonPath Class]
+// =============================================================================
+
+/**
+ * @brief A path to a nested value, compiled once and evaluated against
+ * many documents. Two spellings are accepted:
+ *  - JSON Pointer (RFC 6901): "/user/profile/id", "/items/3" ("" is the
+ *    root; "~0" and "~1" stand for '~' and '/'). A numeric token indexes
+ *    an array, or names a member of an object;
+ *  - dotted: "user.profile.id", "items[3].name", "[0].id".
+ * Key hashes are computed once. Each step also remembers the member
+ * position it matched last time, so documents of the same shape are
+ * resolved with one key comparison per level. A path may be shared by
+ * threads evaluating it concurrently.
+ */
+class JsonPath
+{
+public:
+    /** @throws TinyJsonException if `path` is malformed. */
+    explicit JsonPath( StringView path );
+
+    /**
+     * @brief The value at this path under `root`, or nullptr if a member
+     * is missing, an index is out of range, or a step meets a scalar.
+     */
+    const Json* find( const Json& root ) const;
+
+    /** @throws TinyJsonException if the path does not exist in `root`. */
+    const Json& get( const Json& root ) const;
+
+    bool exists( const Json& root ) const { return this->find( root ) != nullptr; }
+
+    /** @brief The text the path was compiled from. */
+    const std::string& str() const noexcept { return text; }
+
+    /** @brief Number of steps (0 for the root). */
+    std::size_t depth() const noexcept { return steps.size(); }
+
+private:
+    static const std::size_t NO_INDEX = static_cast<std::size_t>( -1 );
+
+    struct Step {
+        std::string key;           // member name; empty for "[n]" steps
+        uint32_t    hash;          // of `key`, as used by the object index
+        std::size_t index;         // array index, or NO_INDEX
+        bool        isKey;         // may name an object member
+        mutable std::atomic<uint32_t> hint{ 0 }; // member position last matched
+
+        Step( std::string k, std::size_t i, bool keyed );
+        Step( const Step& other );
+        Step& operator=( const Step& other );
+    };
+
+    std::string       text;
+    std::vector<Step> steps;
+};
+
+// =============================================================================
+// [StreamParser Class]
+// =============================================================================
+
+/**
+ * @brief Incremental (push) parser for a stream of JSON values.
+ * Input may be split at any byte, including inside strings, numbers and
+ * escapes; each feed() advances the parse, and every top-level value is
+ * handed out as soon as it is complete. Consecutive values may simply be
+ * separated by whitespace (e.g. JSON Lines).
+ */
+class StreamParser
+{
+public:
+    using Callback = std::function<void( Json&& )>;
+
+    /** @brief Completed values are queued; fetch them with next(). */
+    StreamParser();
+    explicit StreamParser( const ParseOptions& options );
+
+    /** @brief Completed values are passed to `onValue` instead of queued. */
+    explicit StreamParser( Callback onValue, const ParseOptions& options = ParseOptions() );
+
+    ~StreamParser();
+    StreamParser( StreamParser&& other ) noexcept;
+    StreamParser& operator=( StreamParser&& other ) noexcept;
+
+    /**
+     * @brief Parses the next chunk of input.
+     * @throws TinyJsonException on malformed input. The parser then stays
+     * failed until reset().
+     */
+    void feed( const char* data, std::size_t length );
+    void feed( const std::string& chunk );
+
+    /**
+     * @brief Marks the end of input: completes a trailing top-level number
+     * and checks that no value was left unfinished.
+     * @throws TinyJsonException if the stream ends inside a value.
+     */
+    void finish();
+
+    /**
+     * @brief True if a completed value is waiting in the queue.
+     * @throws TinyJsonException if the parser was moved from (see reset()).
+     */
+    bool hasValue() const;
+
+    /**
+     * @brief Removes and returns the oldest completed value.
+     * @throws TinyJsonException if no value is available.
+     */
+    Json next();
+
+    /**
+     * @brief Discards all state (partial value, queue, failure). Also makes
+     * a moved-from parser usable again; every other member throws on one.
+     */
+    void reset();
+
+private:
+    struct State; // defined in TinyJson.cpp
+    std::unique_ptr<State> state;
+
+    State& checkedState() const;
+};
+
+// =============================================================================
+// [Arena]
+// =============================================================================
+
+/**
+ * @brief Monotonic memory arena. Allocations are carved from large blocks
+ * and never freed one by one: release() returns every block at once.
+ */
+class Arena
+{
+public:
+    /** @param blockSize Minimum size of each block; larger requests get a block of their own. */
+    explicit Arena( std::size_t blockSize = 64 * 1024 ) noexcept;
+    ~Arena();
+
+    Arena( const Arena& )            = delete;
+    Arena& operator=( const Arena& ) = delete;
+
+    /** @throws std::bad_alloc if a new block cannot be obtained. */
+    void* allocate( std::size_t bytes, std::size_t align );
+
+    /** @brief Frees every block; all memory handed out becomes invalid. */
+    void release() noexcept;
+
+    /** @brief Bytes held in blocks, used or not. */
+    std::size_t capacity() const noexcept { return total; }
+
+private:
+    struct Block; // header in front of each block, defined in TinyJson.cpp
+
+    Block*      head;      // most recent block; each links to the one before
+    char*       cur;       // free space of the head block
+    char*       end;
+    std::size_t blockSize;
+    std::size_t total;
+};
+
+/**
+ * @brief Standard allocator over an Arena; deallocate() is a no-op.
+ * Without an arena it falls back to operator new / delete.
+ */
+template <typename T>
+class ArenaAllocator
+{
+public:
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap            = std::true_type;
+
+    ArenaAllocator( Arena* arena = nullptr ) noexcept : arena( arena ) {}
+    template <typename U>
+    ArenaAllocator( const ArenaAllocator<U>& other ) noexcept : arena( other.arena ) {}
+
+    T* allocate( std::size_t n )
+    {
+        if( this->arena )
+            return static_cast<T*>( this->arena->allocate( n * sizeof( T ), alignof( T ) ) );
+        return static_cast<T*>( ::operator new( n * sizeof( T ) ) );
+    }
+
+    void deallocate( T* p, std::size_t ) noexcept
+    {
+        if( !this->arena ) ::operator delete( p );
+    }
+
+    template <typename U> bool operator==( const ArenaAllocator<U>& other ) const noexcept { return arena == other.arena; }
+    template <typename U> bool operator!=( const ArenaAllocator<U>& other ) const noexcept { return arena != other.arena; }
+
+    Arena* arena;
+};
+
+// =============================================================================
+// [ViewDocument & JsonView Classes]
+// =============================================================================
+
+/**
+ * @brief Read-only document produced by Parser::parseInSitu().
+ * Nodes are stored in one flat array in document order; all text is viewed
+ * in the caller's buffer, so no string or key is ever copied.
+ */
+class ViewDocument
+{
+    friend class Parser;
+    friend class JsonView;
+    friend class Document;
+
+public:
+    ViewDocument() = default;
+
+    /** @brief Returns the root value (null for blank input). */
+    JsonView root() const noexcept;
+
+    /** @brief Number of nodes (values and keys) in the document. */
+    std::size_t nodeCount() const noexcept { return nodes.size(); }
+
+private:
+    struct Node {
+        JsonType    type;
+        uint32_t    span;  ///< Nodes in this subtree, including itself
+        uint32_t    count; ///< Elements (array) or members (object)
+        const char* str;   ///< Text of strings, keys, numbers and literals
+        std::size_t len;
+    };
+
+    // On the heap for parseInSitu(), in the owning Document's arena otherwise
+    std::vector<Node, ArenaAllocator<Node>> nodes;
+};
+
+/**
+ * @brief Lightweight handle to one value of a ViewDocument.
+ * Mirrors the read API of Json; copying a JsonView copies a pointer.
+ */
+class JsonView
+{
+    friend class ViewDocument;
+
+public:
+    /**
+     * @brief Iterator over the children of an array or object.
+     * For objects, key() returns the member name.
+     */
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = JsonView;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const JsonView*;
+        using reference         = JsonView;
+
+        const_iterator( const ViewDocument::Node* n, bool obj, std::size_t i )
+            : node( n ), isObj( obj ), idx( i )
+        {}
+
+        JsonView    operator*() const { return JsonView( isObj ? node + 1 : node ); }
+        StringView  key()       const { return isObj ? StringView( node->str, node->len ) : StringView(); }
+        JsonView    value()     const { return operator*(); }
+        std::size_t index()     const { return idx; }
+
+        const_iterator& operator++()
+        {
+            if( isObj ) node += 1 + node[1].span; // key + value subtree
+            else        node += node->span;
+            ++idx;
+            return *this;
+        }
+
+        const_iterator operator++( int )
+        {
+            const_iterator tmp = *this;
+            ++( *this );
+            return tmp;
+        }
+
+        bool operator!=( const const_iterator& other ) const { return idx != other.idx; }
+        bool operator==( const const_iterator& other ) const { return idx == other.idx; }
+
+    private:
+        const ViewDocument::Node* node;
+        bool                      isObj;
+        std::size_t               idx;
+    };
+
+    /**
+     * @brief Range returned by items(); yields iterators exposing key() / value().
+     */
+    class ItemsRange
+    {
+    public:
+        class items_iterator : public const_iterator
+        {
+        public:
+            items_iterator( const const_iterator& it ) : const_iterator( it ) {}
+            const const_iterator& operator*() const { return *this; }
+        };
+
+        ItemsRange( const_iterator b, const_iterator e ) : m_begin( b ), m_end( e ) {}
+
+        items_iterator begin() const { return items_iterator( m_begin ); }
+        items_iterator end()   const { return items_iterator( m_end   ); }
+
+    private:
+        const_iterator m_begin;
+        const_iterator m_end;
+    };
+
+    // =========================================================================
+    // [Type Checks]
+    // =========================================================================
+    JsonType type() const noexcept { return node ? node->type : JsonType::UNKNOWN; }
+
+    inline bool isNull()   const { return type() == JsonType::NULL_TYPE; }
+    inline bool isObject() const { return type() == JsonType::OBJECT;    }
+    inline bool isArray()  const { return type() == JsonType::ARRAY;     }
+    inline bool isString() const { return type() == JsonType::STRING;    }
+    inline bool isDouble() const { return type() == JsonType::DOUBLE;    }
+    inline bool isInt()    const { return type() == JsonType::INT;       }
+    inline bool isBool()   const { return type() == JsonType::BOOLEAN;   }
+    inline bool isValid()  const { return type() != JsonType::UNKNOWN;   }
+
+    // =========================================================================
+    // [Access]
+    // =========================================================================
+    JsonView operator[]( const int arrIdx ) const;
+    JsonView operator[]( StringView key ) const;
+    JsonView operator[]( const char* key ) const { return operator[]( StringView( key ) ); }
+
+    bool contains( StringView key ) const noexcept;
+
+    /**
+     * @brief Converts the value to T (int, double, bool, std::string, StringView).
+     * @throws TinyJsonException if a number does not fit in int.
+     */
+    template <typename T> T getAs() const;
+
+    template <typename T>
+    bool tryGetAs( T& ref ) const
+    {
+        if( ( std::is_same<T, std::string>::value && this->isString() ) ||
+            ( std::is_same<T, StringView>::value  && this->isString() ) ||
+            ( std::is_same<T, double>::value      && this->isDouble() ) ||
+            ( std::is_same<T, int>::value         && this->isInt()    ) ||
+            ( std::is_same<T, bool>::value        && this->isBool()   ) )
+        {
+            try {
+                ref = getAs<T>();
+                return true;
+            } catch( ... ) { return false; }
+        }
+        return false;
+    }
+
+    // =========================================================================
+    // [Utility Methods]
+    // =========================================================================
+    std::size_t size() const noexcept;
+    std::vector<std::string> keys() const;
+
+    const_iterator begin() const;
+    const_iterator end()   const;
+    ItemsRange     items() const { return ItemsRange( begin(), end() ); }
+
+private:
+    explicit JsonView( const ViewDocument::Node* n ) noexcept : node( n ) {}
+
+    const ViewDocument::Node* node;
+};
+
+template <> int         JsonView::getAs<int>()         const;
+template <> double      JsonView::getAs<double>()      const;
+template <> bool        JsonView::getAs<bool>()        const;
+template <> std::string JsonView::getAs<std::string>() const;
+template <> StringView  JsonView::getAs<StringView>()  const;
+
+// =============================================================================
+// [Document Class]
+// =============================================================================
+
+/**
+ * @brief Parsed document that owns all of its memory in an Arena.
+ * The text is copied into the arena once and its strings are decoded in
+ * place; the nodes are carved from the same arena. A parse therefore costs
+ * a few large allocations, and destroying or resetting the document frees
+ * everything in one step instead of node by node. Values are read through
+ * JsonView, as with parseInSitu().
+ */
+class Document
+{
+public:
+    /** @param blockSize Minimum size of each arena block. */
+    explicit Document( std::size_t blockSize = 64 * 1024 );
+
+    Document( Document&& ) noexcept            = default;
+    Document& operator=( Document&& ) noexcept = default;
+
+    /**
+     * @brief Replaces the content with the parsed `text`. The previous
+     * content is released first, so earlier JsonViews become invalid.
+     * @return The root value.
+     * @throws TinyJsonException if parsing fails; the document is then empty.
+     */
+    JsonView parse( StringView text, const ParseOptions& options = ParseOptions() );
+
+    /**
+     * @brief parse() without exceptions.
+     * @return Success, or the error with its position; the document is empty on failure.
+     */
+    ParseResult tryParse( StringView text, const ParseOptions& options = ParseOptions() ) noexcept;
+
+    /** @brief Returns the root value (null when empty). */
+    JsonView root() const noexcept { return view.root(); }
+
+    /** @brief Number of nodes (values and keys) in the document. */
+    std::size_t nodeCount() const noexcept { return view.nodeCount(); }
+
+    /** @brief Bytes held by the arena. */
+    std::size_t memoryUsage() const noexcept { return arena ? arena->capacity() : 0; }
+
+    /** @brief Frees every node and string at once; the document becomes empty. */
+    void reset() noexcept;
+
+private:
+    std::size_t            blockSize;
+    std::unique_ptr<Arena> arena; // stable address for the node allocator
+    ViewDocument           view;
+};
+
+
+// =============================================================================
+// [TapeDocument & TapeView Classes]
+// =============================================================================
+
+/**
+ * @brief Frozen, read-only document produced by Parser::parseTape().
+ * The tree is a single array of 64-bit words in document (depth-first)
+ * order, each an 8-bit tag and a 56-bit payload:
+ *  - null, true, false: one word;
+ *  - integers and doubles: a tag word followed by the raw 64-bit value;
+ *  - strings and keys: the offset of their text in a separate string
+ *    buffer (a 32-bit length, the bytes, a terminating '\0');
+ *  - objects and arrays: their member count and the number of words in
+ *    their subtree, so a whole container is skipped in one step.
+ * An object member is its key word followed by the value's words.
+ * Members are looked up by scanning in order. Duplicate keys are resolved
+ * while parsing, as in Json: a repeated key keeps its first position and
+ * the value of its last occurrence.
+ */
+class TapeDocument
+{
+    friend class Parser;
+    friend class TapeView;
+
+public:
+    TapeDocument() = default;
+
+    /** @brief Returns the root value (invalid for an empty document). */
+    TapeView root() const noexcept;
+
+    /** @brief Number of 64-bit words on the tape. */
+    std::size_t tapeSize() const noexcept { return tape.size(); }
+
+    /** @brief Bytes held by the tape and the string buffer. */
+    std::size_t memoryUsage() const noexcept { return tape.capacity() * sizeof( uint64_t ) + strings.capacity(); }
+
+private:
+    enum Tag : uint8_t {
+        TagNull   = 'n', TagTrue   = 't', TagFalse  = 'f',
+        TagInt64  = 'l', TagUInt64 = 'u', TagDouble = 'd',
+        TagBigInt    = 'b', // beyond 64 bits: the digits are kept in `strings`
+        TagBigDouble = 'D', // beyond the double range: the text is kept in `strings`
+        TagString = '"', TagObject = '{', TagArray  = '['
+    };
+
+    // Container payload: count in bits 32..55 (saturated), span in bits 0..31.
+    // Hence a container spans fewer than 2^32 tape words and a string (its
+    // length is stored as uint32_t) holds fewer than 2^32 bytes; a document
+    // beyond either fails with ParseError::DocumentTooLarge. Counts past
+    // COUNT_SATURATED are only stored as that value and recounted on demand.
+    enum : uint32_t { COUNT_SATURATED = 0xFFFFFF };
+
+    static uint64_t    word( Tag tag, uint64_t payload ) noexcept { return ( static_cast<uint64_t>( tag ) << 56 ) | payload; }
+    static Tag         tagOf( uint64_t w )     noexcept { return static_cast<Tag>( w >> 56 ); }
+    static uint64_t    payloadOf( uint64_t w ) noexcept { return w & ( ( static_cast<uint64_t>( 1 ) << 56 ) - 1 ); }
+    static std::size_t spanOf( uint64_t w )    noexcept { return static_cast<uint32_t>( w ); }
+    static uint32_t    countOf( uint64_t w )   noexcept { return static_cast<uint32_t>( w >> 32 ) & COUNT_SATURATED; }
+
+    std::vector<uint64_t> tape;
+    std::vector<char>     strings;
+};
+
+/**
+ * @brief Cursor to one value of a TapeDocument (a pointer to its first
+ * word). Mirrors the read API of Json; copying a TapeView copies two
+ * pointers. Valid while the document is alive and unchanged.
+ */
+class TapeView
+{
+    friend class TapeDocument;
+
+public:
+    /**
+     * @brief Iterator over the children of an array or object.
+     * For objects, key() returns the member name.
+     */
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = TapeView;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const TapeView*;
+        using reference         = TapeView;
+
+        const_iterator( const uint64_t* w, const char* strings, bool obj, std::size_t i )
+            : word( w ), strings( strings ), isObj( obj ), idx( i )
+        {}
+
+        TapeView    operator*() const { return TapeView( isObj ? word + 1 : word, strings ); }
+        StringView  key()       const { return isObj ? TapeView::text( *word, strings ) : StringView(); }
+        TapeView    value()     const { return operator*(); }
+        std::size_t index()     const { return idx; }
+
+        const_iterator& operator++()
+        {
+            if( isObj ) word += 1 + TapeView::width( word + 1 ); // key + value
+            else        word += TapeView::width( word );
+            ++idx;
+            return *this;
+        }
+
+        const_iterator operator++( int )
+        {
+            const_iterator tmp = *this;
+            ++( *this );
+            return tmp;
+        }
+
+        bool operator!=( const const_iterator& other ) const { return idx != other.idx; }
+        bool operator==( const const_iterator& other ) const { return idx == other.idx; }
+
+    private:
+        const uint64_t* word;
+        const char*     strings;
+        bool            isObj;
+        std::size_t     idx;
+    };
+
+    /**
+     * @brief Range returned by items(); yields iterators exposing key() / value().
+     */
+    class ItemsRange
+    {
+    public:
+        class items_iterator : public const_iterator
+        {
+        public:
+            items_iterator( const const_iterator& it ) : const_iterator( it ) {}
+            const const_iterator& operator*() const { return *this; }
+        };
+
+        ItemsRange( const_iterator b, const_iterator e ) : m_begin( b ), m_end( e ) {}
+
+        items_iterator begin() const { return items_iterator( m_begin ); }
+        items_iterator end()   const { return items_iterator( m_end   ); }
+
+    private:
+        const_iterator m_begin;
+        const_iterator m_end;
+    };
+
+    // =========================================================================
+    // [Type Checks]
+    // =========================================================================
+    JsonType type() const noexcept;
+
+    inline bool isNull()   const { return type() == JsonType::NULL_TYPE; }
+    inline bool isObject() const { return type() == JsonType::OBJECT;    }
+    inline bool isArray()  const { return type() == JsonType::ARRAY;     }
+    inline bool isString() const { return type() == JsonType::STRING;    }
+    inline bool isDouble() const { return type() == JsonType::DOUBLE;    }
+    inline bool isInt()    const { return type() == JsonType::INT;       }
+    inline bool isBool()   const { return type() == JsonType::BOOLEAN;   }
+    inline bool isValid()  const { return type() != JsonType::UNKNOWN;   }
+
+    // =========================================================================
+    // [Access]
+    // =========================================================================
+    TapeView operator[]( const int arrIdx ) const;
+    TapeView operator[]( StringView key ) const;
+    TapeView operator[]( const char* key ) const { return operator[]( StringView( key ) ); }
+
+    bool contains( StringView key ) const noexcept;
+
+    /**
+     * @brief Converts the value to T with the same rules (and range
+     * checks) as Json::getAs; StringView is also supported and views the
+     * document's string buffer.
+     */
+    template <typename T> T getAs() const { return this->scalar().getAs<T>(); }
+
+    template <typename T>
+    bool tryGetAs( T& ref ) const
+    {
+        const bool isInteger = std::is_integral<T>::value && !std::is_same<T, bool>::value;
+
+        if( ( std::is_same<T, std::string>::value && this->isString() ) ||
+            ( std::is_same<T, StringView>::value  && this->isString() ) ||
+            ( std::is_same<T, double>::value      && this->isDouble() ) ||
+            ( isInteger                           && this->isInt()    ) ||
+            ( std::is_same<T, bool>::value        && this->isBool()   ) )
+        {
+            try {
+                ref = getAs<T>();
+                return true;
+            } catch( ... ) { return false; }
+        }
+        return false;
+    }
+
+    // =========================================================================
+    // [Utility Methods]
+    // =========================================================================
+    std::size_t size() const noexcept;
+    std::vector<std::string> keys() const;
+
+    const_iterator begin() const;
+    const_iterator end()   const;
+    ItemsRange     items() const { return ItemsRange( begin(), end() ); }
+
+    /** @brief Builds a mutable Json copy of this value (and its subtree). */
+    Json toJson() const;
+
+    /** @brief Serializes the value, as Json::toString does. */
+    std::string toString( ToStringType type = ToStringType::Strip, bool asciiOnly = false ) const;
+
+private:
+    TapeView( const uint64_t* w, const char* strings ) noexcept : word( w ), strings( strings ) {}
+
+    // Words taken by the value starting at `w`
+    static std::size_t width( const uint64_t* w ) noexcept
+    {
+        switch( TapeDocument::tagOf( *w ) ) {
+            case TapeDocument::TagObject:
+            case TapeDocument::TagArray:  return TapeDocument::spanOf( *w );
+            case TapeDocument::TagInt64:
+            case TapeDocument::TagUInt64:
+            case TapeDocument::TagDouble: return 2;
+            default:                      return 1;
+        }
+    }
+
+    // Text of a string, key, BigInt or BigDouble word
+    static StringView text( uint64_t w, const char* strings ) noexcept
+    {
+        const char* at = strings + TapeDocument::payloadOf( w );
+        uint32_t    len;
+        std::memcpy( &len, at, sizeof( len ) );
+        return StringView( at + sizeof( len ), len );
+    }
+
+    // The value as a Json scalar (containers yield null); getAs reads it
+    Json scalar() const;
+
+    const uint64_t* word;    // null for an empty document
+    const char*     strings;
+};
+
+template <> std::string TapeView::getAs<std::string>() const;
+template <> StringView  TapeView::getAs<StringView>()  const;
+
 } // namespace TinyJson
 
 #endif // _TINY_JSON_H_
\ No newline at end of file
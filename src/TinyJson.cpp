@@ -17,846 +17,5927 @@
 #include <stack>
 #include <cassert>
 #include <algorithm> // for std::swap, std::move
+#include <cstring>   // for std::memcmp, std::strlen
+#include <cctype>    // for isxdigit
+#include <cstdlib>   // for std::strtod, std::strtoll
+#include <cstdint>
+#include <cstddef>   // for std::max_align_t
+#include <memory>    // for std::unique_ptr
+#include <deque>
+#include <limits>
+#include <cmath>     // for std::isfinite, std::isinf
+#include <thread>
+#include <system_error> // for std::system_error
+#include <mutex>
+#include <condition_variable>
+
+#if defined( __x86_64__ ) || defined( _M_X64 )
+    #define TINYJSON_X86_64 1
+    #include <emmintrin.h> // SSE2
+#else
+    #define TINYJSON_X86_64 0
+#endif
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+    #define TINYJSON_HAS_MMAP 1
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#else
+    #define TINYJSON_HAS_MMAP 0
+#endif
+
+// AVX2 is compiled per-function and selected at runtime (GCC/Clang only)
+#if TINYJSON_X86_64 && defined( __GNUC__ )
+    #define TINYJSON_HAS_AVX2 1
+    #include <immintrin.h>
+#else
+    #define TINYJSON_HAS_AVX2 0
+#endif
 
 namespace TinyJson {
 
 // =============================================================================
-// [Global Helper Functions]
+// [Number Parsing]
 // =============================================================================
+// Numbers are converted once, when a node is built. Integers are stored as
+// int64 (or uint64 above INT64_MAX). Everything else is converted with the
+// Clinger fast path when both operands are exact doubles, otherwise with the
+// Eisel-Lemire algorithm: one (rarely two) 64x128-bit multiplications by a
+// truncated power of five give the correctly rounded result. Only inputs
+// with more than 19 significant digits that land on a rounding boundary
+// fall back to strtod.
 
-Json JsonObject()
+namespace {
+
+struct Uint128
 {
-    return Json( JsonType::OBJECT );
+    uint64_t high;
+    uint64_t low;
+};
+
+const int SMALLEST_POWER_OF_TEN = -342; // below: rounds to zero
+const int LARGEST_POWER_OF_TEN  = 308;  // above: infinity
+
+/// 5^q normalized to 128 bits (truncated), for q in [-342, 308]
+const Uint128 POWER_OF_FIVE_128[] = {
+    { 0xeef453d6923bd65aULL, 0x113faa2906a13b3fULL }, { 0x9558b4661b6565f8ULL, 0x4ac7ca59a424c507ULL },
+    { 0xbaaee17fa23ebf76ULL, 0x5d79bcf00d2df649ULL }, { 0xe95a99df8ace6f53ULL, 0xf4d82c2c107973dcULL },
+    { 0x91d8a02bb6c10594ULL, 0x79071b9b8a4be869ULL }, { 0xb64ec836a47146f9ULL, 0x9748e2826cdee284ULL },
+    { 0xe3e27a444d8d98b7ULL, 0xfd1b1b2308169b25ULL }, { 0x8e6d8c6ab0787f72ULL, 0xfe30f0f5e50e20f7ULL },
+    { 0xb208ef855c969f4fULL, 0xbdbd2d335e51a935ULL }, { 0xde8b2b66b3bc4723ULL, 0xad2c788035e61382ULL },
+    { 0x8b16fb203055ac76ULL, 0x4c3bcb5021afcc31ULL }, { 0xaddcb9e83c6b1793ULL, 0xdf4abe242a1bbf3dULL },
+    { 0xd953e8624b85dd78ULL, 0xd71d6dad34a2af0dULL }, { 0x87d4713d6f33aa6bULL, 0x8672648c40e5ad68ULL },
+    { 0xa9c98d8ccb009506ULL, 0x680efdaf511f18c2ULL }, { 0xd43bf0effdc0ba48ULL, 0x0212bd1b2566def2ULL },
+    { 0x84a57695fe98746dULL, 0x014bb630f7604b57ULL }, { 0xa5ced43b7e3e9188ULL, 0x419ea3bd35385e2dULL },
+    { 0xcf42894a5dce35eaULL, 0x52064cac828675b9ULL }, { 0x818995ce7aa0e1b2ULL, 0x7343efebd1940993ULL },
+    { 0xa1ebfb4219491a1fULL, 0x1014ebe6c5f90bf8ULL }, { 0xca66fa129f9b60a6ULL, 0xd41a26e077774ef6ULL },
+    { 0xfd00b897478238d0ULL, 0x8920b098955522b4ULL }, { 0x9e20735e8cb16382ULL, 0x55b46e5f5d5535b0ULL },
+    { 0xc5a890362fddbc62ULL, 0xeb2189f734aa831dULL }, { 0xf712b443bbd52b7bULL, 0xa5e9ec7501d523e4ULL },
+    { 0x9a6bb0aa55653b2dULL, 0x47b233c92125366eULL }, { 0xc1069cd4eabe89f8ULL, 0x999ec0bb696e840aULL },
+    { 0xf148440a256e2c76ULL, 0xc00670ea43ca250dULL }, { 0x96cd2a865764dbcaULL, 0x380406926a5e5728ULL },
+    { 0xbc807527ed3e12bcULL, 0xc605083704f5ecf2ULL }, { 0xeba09271e88d976bULL, 0xf7864a44c633682eULL },
+    { 0x93445b8731587ea3ULL, 0x7ab3ee6afbe0211dULL }, { 0xb8157268fdae9e4cULL, 0x5960ea05bad82964ULL },
+    { 0xe61acf033d1a45dfULL, 0x6fb92487298e33bdULL }, { 0x8fd0c16206306babULL, 0xa5d3b6d479f8e056ULL },
+    { 0xb3c4f1ba87bc8696ULL, 0x8f48a4899877186cULL }, { 0xe0b62e2929aba83cULL, 0x331acdabfe94de87ULL },
+    { 0x8c71dcd9ba0b4925ULL, 0x9ff0c08b7f1d0b14ULL }, { 0xaf8e5410288e1b6fULL, 0x07ecf0ae5ee44dd9ULL },
+    { 0xdb71e91432b1a24aULL, 0xc9e82cd9f69d6150ULL }, { 0x892731ac9faf056eULL, 0xbe311c083a225cd2ULL },
+    { 0xab70fe17c79ac6caULL, 0x6dbd630a48aaf406ULL }, { 0xd64d3d9db981787dULL, 0x092cbbccdad5b108ULL },
+    { 0x85f0468293f0eb4eULL, 0x25bbf56008c58ea5ULL }, { 0xa76c582338ed2621ULL, 0xaf2af2b80af6f24eULL },
+    { 0xd1476e2c07286faaULL, 0x1af5af660db4aee1ULL }, { 0x82cca4db847945caULL, 0x50d98d9fc890ed4dULL },
+    { 0xa37fce126597973cULL, 0xe50ff107bab528a0ULL }, { 0xcc5fc196fefd7d0cULL, 0x1e53ed49a96272c8ULL },
+    { 0xff77b1fcbebcdc4fULL, 0x25e8e89c13bb0f7aULL }, { 0x9faacf3df73609b1ULL, 0x77b191618c54e9acULL },
+    { 0xc795830d75038c1dULL, 0xd59df5b9ef6a2417ULL }, { 0xf97ae3d0d2446f25ULL, 0x4b0573286b44ad1dULL },
+    { 0x9becce62836ac577ULL, 0x4ee367f9430aec32ULL }, { 0xc2e801fb244576d5ULL, 0x229c41f793cda73fULL },
+    { 0xf3a20279ed56d48aULL, 0x6b43527578c1110fULL }, { 0x9845418c345644d6ULL, 0x830a13896b78aaa9ULL },
+    { 0xbe5691ef416bd60cULL, 0x23cc986bc656d553ULL }, { 0xedec366b11c6cb8fULL, 0x2cbfbe86b7ec8aa8ULL },
+    { 0x94b3a202eb1c3f39ULL, 0x7bf7d71432f3d6a9ULL }, { 0xb9e08a83a5e34f07ULL, 0xdaf5ccd93fb0cc53ULL },
+    { 0xe858ad248f5c22c9ULL, 0xd1b3400f8f9cff68ULL }, { 0x91376c36d99995beULL, 0x23100809b9c21fa1ULL },
+    { 0xb58547448ffffb2dULL, 0xabd40a0c2832a78aULL }, { 0xe2e69915b3fff9f9ULL, 0x16c90c8f323f516cULL },
+    { 0x8dd01fad907ffc3bULL, 0xae3da7d97f6792e3ULL }, { 0xb1442798f49ffb4aULL, 0x99cd11cfdf41779cULL },
+    { 0xdd95317f31c7fa1dULL, 0x40405643d711d583ULL }, { 0x8a7d3eef7f1cfc52ULL, 0x482835ea666b2572ULL },
+    { 0xad1c8eab5ee43b66ULL, 0xda3243650005eecfULL }, { 0xd863b256369d4a40ULL, 0x90bed43e40076a82ULL },
+    { 0x873e4f75e2224e68ULL, 0x5a7744a6e804a291ULL }, { 0xa90de3535aaae202ULL, 0x711515d0a205cb36ULL },
+    { 0xd3515c2831559a83ULL, 0x0d5a5b44ca873e03ULL }, { 0x8412d9991ed58091ULL, 0xe858790afe9486c2ULL },
+    { 0xa5178fff668ae0b6ULL, 0x626e974dbe39a872ULL }, { 0xce5d73ff402d98e3ULL, 0xfb0a3d212dc8128fULL },
+    { 0x80fa687f881c7f8eULL, 0x7ce66634bc9d0b99ULL }, { 0xa139029f6a239f72ULL, 0x1c1fffc1ebc44e80ULL },
+    { 0xc987434744ac874eULL, 0xa327ffb266b56220ULL }, { 0xfbe9141915d7a922ULL, 0x4bf1ff9f0062baa8ULL },
+    { 0x9d71ac8fada6c9b5ULL, 0x6f773fc3603db4a9ULL }, { 0xc4ce17b399107c22ULL, 0xcb550fb4384d21d3ULL },
+    { 0xf6019da07f549b2bULL, 0x7e2a53a146606a48ULL }, { 0x99c102844f94e0fbULL, 0x2eda7444cbfc426dULL },
+    { 0xc0314325637a1939ULL, 0xfa911155fefb5308ULL }, { 0xf03d93eebc589f88ULL, 0x793555ab7eba27caULL },
+    { 0x96267c7535b763b5ULL, 0x4bc1558b2f3458deULL }, { 0xbbb01b9283253ca2ULL, 0x9eb1aaedfb016f16ULL },
+    { 0xea9c227723ee8bcbULL, 0x465e15a979c1cadcULL }, { 0x92a1958a7675175fULL, 0x0bfacd89ec191ec9ULL },
+    { 0xb749faed14125d36ULL, 0xcef980ec671f667bULL }, { 0xe51c79a85916f484ULL, 0x82b7e12780e7401aULL },
+    { 0x8f31cc0937ae58d2ULL, 0xd1b2ecb8b0908810ULL }, { 0xb2fe3f0b8599ef07ULL, 0x861fa7e6dcb4aa15ULL },
+    { 0xdfbdcece67006ac9ULL, 0x67a791e093e1d49aULL }, { 0x8bd6a141006042bdULL, 0xe0c8bb2c5c6d24e0ULL },
+    { 0xaecc49914078536dULL, 0x58fae9f773886e18ULL }, { 0xda7f5bf590966848ULL, 0xaf39a475506a899eULL },
+    { 0x888f99797a5e012dULL, 0x6d8406c952429603ULL }, { 0xaab37fd7d8f58178ULL, 0xc8e5087ba6d33b83ULL },
+    { 0xd5605fcdcf32e1d6ULL, 0xfb1e4a9a90880a64ULL }, { 0x855c3be0a17fcd26ULL, 0x5cf2eea09a55067fULL },
+    { 0xa6b34ad8c9dfc06fULL, 0xf42faa48c0ea481eULL }, { 0xd0601d8efc57b08bULL, 0xf13b94daf124da26ULL },
+    { 0x823c12795db6ce57ULL, 0x76c53d08d6b70858ULL }, { 0xa2cb1717b52481edULL, 0x54768c4b0c64ca6eULL },
+    { 0xcb7ddcdda26da268ULL, 0xa9942f5dcf7dfd09ULL }, { 0xfe5d54150b090b02ULL, 0xd3f93b35435d7c4cULL },
+    { 0x9efa548d26e5a6e1ULL, 0xc47bc5014a1a6dafULL }, { 0xc6b8e9b0709f109aULL, 0x359ab6419ca1091bULL },
+    { 0xf867241c8cc6d4c0ULL, 0xc30163d203c94b62ULL }, { 0x9b407691d7fc44f8ULL, 0x79e0de63425dcf1dULL },
+    { 0xc21094364dfb5636ULL, 0x985915fc12f542e4ULL }, { 0xf294b943e17a2bc4ULL, 0x3e6f5b7b17b2939dULL },
+    { 0x979cf3ca6cec5b5aULL, 0xa705992ceecf9c42ULL }, { 0xbd8430bd08277231ULL, 0x50c6ff782a838353ULL },
+    { 0xece53cec4a314ebdULL, 0xa4f8bf5635246428ULL }, { 0x940f4613ae5ed136ULL, 0x871b7795e136be99ULL },
+    { 0xb913179899f68584ULL, 0x28e2557b59846e3fULL }, { 0xe757dd7ec07426e5ULL, 0x331aeada2fe589cfULL },
+    { 0x9096ea6f3848984fULL, 0x3ff0d2c85def7621ULL }, { 0xb4bca50b065abe63ULL, 0x0fed077a756b53a9ULL },
+    { 0xe1ebce4dc7f16dfbULL, 0xd3e8495912c62894ULL }, { 0x8d3360f09cf6e4bdULL, 0x64712dd7abbbd95cULL },
+    { 0xb080392cc4349decULL, 0xbd8d794d96aacfb3ULL }, { 0xdca04777f541c567ULL, 0xecf0d7a0fc5583a0ULL },
+    { 0x89e42caaf9491b60ULL, 0xf41686c49db57244ULL }, { 0xac5d37d5b79b6239ULL, 0x311c2875c522ced5ULL },
+    { 0xd77485cb25823ac7ULL, 0x7d633293366b828bULL }, { 0x86a8d39ef77164bcULL, 0xae5dff9c02033197ULL },
+    { 0xa8530886b54dbdebULL, 0xd9f57f830283fdfcULL }, { 0xd267caa862a12d66ULL, 0xd072df63c324fd7bULL },
+    { 0x8380dea93da4bc60ULL, 0x4247cb9e59f71e6dULL }, { 0xa46116538d0deb78ULL, 0x52d9be85f074e608ULL },
+    { 0xcd795be870516656ULL, 0x67902e276c921f8bULL }, { 0x806bd9714632dff6ULL, 0x00ba1cd8a3db53b6ULL },
+    { 0xa086cfcd97bf97f3ULL, 0x80e8a40eccd228a4ULL }, { 0xc8a883c0fdaf7df0ULL, 0x6122cd128006b2cdULL },
+    { 0xfad2a4b13d1b5d6cULL, 0x796b805720085f81ULL }, { 0x9cc3a6eec6311a63ULL, 0xcbe3303674053bb0ULL },
+    { 0xc3f490aa77bd60fcULL, 0xbedbfc4411068a9cULL }, { 0xf4f1b4d515acb93bULL, 0xee92fb5515482d44ULL },
+    { 0x991711052d8bf3c5ULL, 0x751bdd152d4d1c4aULL }, { 0xbf5cd54678eef0b6ULL, 0xd262d45a78a0635dULL },
+    { 0xef340a98172aace4ULL, 0x86fb897116c87c34ULL }, { 0x9580869f0e7aac0eULL, 0xd45d35e6ae3d4da0ULL },
+    { 0xbae0a846d2195712ULL, 0x8974836059cca109ULL }, { 0xe998d258869facd7ULL, 0x2bd1a438703fc94bULL },
+    { 0x91ff83775423cc06ULL, 0x7b6306a34627ddcfULL }, { 0xb67f6455292cbf08ULL, 0x1a3bc84c17b1d542ULL },
+    { 0xe41f3d6a7377eecaULL, 0x20caba5f1d9e4a93ULL }, { 0x8e938662882af53eULL, 0x547eb47b7282ee9cULL },
+    { 0xb23867fb2a35b28dULL, 0xe99e619a4f23aa43ULL }, { 0xdec681f9f4c31f31ULL, 0x6405fa00e2ec94d4ULL },
+    { 0x8b3c113c38f9f37eULL, 0xde83bc408dd3dd04ULL }, { 0xae0b158b4738705eULL, 0x9624ab50b148d445ULL },
+    { 0xd98ddaee19068c76ULL, 0x3badd624dd9b0957ULL }, { 0x87f8a8d4cfa417c9ULL, 0xe54ca5d70a80e5d6ULL },
+    { 0xa9f6d30a038d1dbcULL, 0x5e9fcf4ccd211f4cULL }, { 0xd47487cc8470652bULL, 0x7647c3200069671fULL },
+    { 0x84c8d4dfd2c63f3bULL, 0x29ecd9f40041e073ULL }, { 0xa5fb0a17c777cf09ULL, 0xf468107100525890ULL },
+    { 0xcf79cc9db955c2ccULL, 0x7182148d4066eeb4ULL }, { 0x81ac1fe293d599bfULL, 0xc6f14cd848405530ULL },
+    { 0xa21727db38cb002fULL, 0xb8ada00e5a506a7cULL }, { 0xca9cf1d206fdc03bULL, 0xa6d90811f0e4851cULL },
+    { 0xfd442e4688bd304aULL, 0x908f4a166d1da663ULL }, { 0x9e4a9cec15763e2eULL, 0x9a598e4e043287feULL },
+    { 0xc5dd44271ad3cdbaULL, 0x40eff1e1853f29fdULL }, { 0xf7549530e188c128ULL, 0xd12bee59e68ef47cULL },
+    { 0x9a94dd3e8cf578b9ULL, 0x82bb74f8301958ceULL }, { 0xc13a148e3032d6e7ULL, 0xe36a52363c1faf01ULL },
+    { 0xf18899b1bc3f8ca1ULL, 0xdc44e6c3cb279ac1ULL }, { 0x96f5600f15a7b7e5ULL, 0x29ab103a5ef8c0b9ULL },
+    { 0xbcb2b812db11a5deULL, 0x7415d448f6b6f0e7ULL }, { 0xebdf661791d60f56ULL, 0x111b495b3464ad21ULL },
+    { 0x936b9fcebb25c995ULL, 0xcab10dd900beec34ULL }, { 0xb84687c269ef3bfbULL, 0x3d5d514f40eea742ULL },
+    { 0xe65829b3046b0afaULL, 0x0cb4a5a3112a5112ULL }, { 0x8ff71a0fe2c2e6dcULL, 0x47f0e785eaba72abULL },
+    { 0xb3f4e093db73a093ULL, 0x59ed216765690f56ULL }, { 0xe0f218b8d25088b8ULL, 0x306869c13ec3532cULL },
+    { 0x8c974f7383725573ULL, 0x1e414218c73a13fbULL }, { 0xafbd2350644eeacfULL, 0xe5d1929ef90898faULL },
+    { 0xdbac6c247d62a583ULL, 0xdf45f746b74abf39ULL }, { 0x894bc396ce5da772ULL, 0x6b8bba8c328eb783ULL },
+    { 0xab9eb47c81f5114fULL, 0x066ea92f3f326564ULL }, { 0xd686619ba27255a2ULL, 0xc80a537b0efefebdULL },
+    { 0x8613fd0145877585ULL, 0xbd06742ce95f5f36ULL }, { 0xa798fc4196e952e7ULL, 0x2c48113823b73704ULL },
+    { 0xd17f3b51fca3a7a0ULL, 0xf75a15862ca504c5ULL }, { 0x82ef85133de648c4ULL, 0x9a984d73dbe722fbULL },
+    { 0xa3ab66580d5fdaf5ULL, 0xc13e60d0d2e0ebbaULL }, { 0xcc963fee10b7d1b3ULL, 0x318df905079926a8ULL },
+    { 0xffbbcfe994e5c61fULL, 0xfdf17746497f7052ULL }, { 0x9fd561f1fd0f9bd3ULL, 0xfeb6ea8bedefa633ULL },
+    { 0xc7caba6e7c5382c8ULL, 0xfe64a52ee96b8fc0ULL }, { 0xf9bd690a1b68637bULL, 0x3dfdce7aa3c673b0ULL },
+    { 0x9c1661a651213e2dULL, 0x06bea10ca65c084eULL }, { 0xc31bfa0fe5698db8ULL, 0x486e494fcff30a62ULL },
+    { 0xf3e2f893dec3f126ULL, 0x5a89dba3c3efccfaULL }, { 0x986ddb5c6b3a76b7ULL, 0xf89629465a75e01cULL },
+    { 0xbe89523386091465ULL, 0xf6bbb397f1135823ULL }, { 0xee2ba6c0678b597fULL, 0x746aa07ded582e2cULL },
+    { 0x94db483840b717efULL, 0xa8c2a44eb4571cdcULL }, { 0xba121a4650e4ddebULL, 0x92f34d62616ce413ULL },
+    { 0xe896a0d7e51e1566ULL, 0x77b020baf9c81d17ULL }, { 0x915e2486ef32cd60ULL, 0x0ace1474dc1d122eULL },
+    { 0xb5b5ada8aaff80b8ULL, 0x0d819992132456baULL }, { 0xe3231912d5bf60e6ULL, 0x10e1fff697ed6c69ULL },
+    { 0x8df5efabc5979c8fULL, 0xca8d3ffa1ef463c1ULL }, { 0xb1736b96b6fd83b3ULL, 0xbd308ff8a6b17cb2ULL },
+    { 0xddd0467c64bce4a0ULL, 0xac7cb3f6d05ddbdeULL }, { 0x8aa22c0dbef60ee4ULL, 0x6bcdf07a423aa96bULL },
+    { 0xad4ab7112eb3929dULL, 0x86c16c98d2c953c6ULL }, { 0xd89d64d57a607744ULL, 0xe871c7bf077ba8b7ULL },
+    { 0x87625f056c7c4a8bULL, 0x11471cd764ad4972ULL }, { 0xa93af6c6c79b5d2dULL, 0xd598e40d3dd89bcfULL },
+    { 0xd389b47879823479ULL, 0x4aff1d108d4ec2c3ULL }, { 0x843610cb4bf160cbULL, 0xcedf722a585139baULL },
+    { 0xa54394fe1eedb8feULL, 0xc2974eb4ee658828ULL }, { 0xce947a3da6a9273eULL, 0x733d226229feea32ULL },
+    { 0x811ccc668829b887ULL, 0x0806357d5a3f525fULL }, { 0xa163ff802a3426a8ULL, 0xca07c2dcb0cf26f7ULL },
+    { 0xc9bcff6034c13052ULL, 0xfc89b393dd02f0b5ULL }, { 0xfc2c3f3841f17c67ULL, 0xbbac2078d443ace2ULL },
+    { 0x9d9ba7832936edc0ULL, 0xd54b944b84aa4c0dULL }, { 0xc5029163f384a931ULL, 0x0a9e795e65d4df11ULL },
+    { 0xf64335bcf065d37dULL, 0x4d4617b5ff4a16d5ULL }, { 0x99ea0196163fa42eULL, 0x504bced1bf8e4e45ULL },
+    { 0xc06481fb9bcf8d39ULL, 0xe45ec2862f71e1d6ULL }, { 0xf07da27a82c37088ULL, 0x5d767327bb4e5a4cULL },
+    { 0x964e858c91ba2655ULL, 0x3a6a07f8d510f86fULL }, { 0xbbe226efb628afeaULL, 0x890489f70a55368bULL },
+    { 0xeadab0aba3b2dbe5ULL, 0x2b45ac74ccea842eULL }, { 0x92c8ae6b464fc96fULL, 0x3b0b8bc90012929dULL },
+    { 0xb77ada0617e3bbcbULL, 0x09ce6ebb40173744ULL }, { 0xe55990879ddcaabdULL, 0xcc420a6a101d0515ULL },
+    { 0x8f57fa54c2a9eab6ULL, 0x9fa946824a12232dULL }, { 0xb32df8e9f3546564ULL, 0x47939822dc96abf9ULL },
+    { 0xdff9772470297ebdULL, 0x59787e2b93bc56f7ULL }, { 0x8bfbea76c619ef36ULL, 0x57eb4edb3c55b65aULL },
+    { 0xaefae51477a06b03ULL, 0xede622920b6b23f1ULL }, { 0xdab99e59958885c4ULL, 0xe95fab368e45ecedULL },
+    { 0x88b402f7fd75539bULL, 0x11dbcb0218ebb414ULL }, { 0xaae103b5fcd2a881ULL, 0xd652bdc29f26a119ULL },
+    { 0xd59944a37c0752a2ULL, 0x4be76d3346f0495fULL }, { 0x857fcae62d8493a5ULL, 0x6f70a4400c562ddbULL },
+    { 0xa6dfbd9fb8e5b88eULL, 0xcb4ccd500f6bb952ULL }, { 0xd097ad07a71f26b2ULL, 0x7e2000a41346a7a7ULL },
+    { 0x825ecc24c873782fULL, 0x8ed400668c0c28c8ULL }, { 0xa2f67f2dfa90563bULL, 0x728900802f0f32faULL },
+    { 0xcbb41ef979346bcaULL, 0x4f2b40a03ad2ffb9ULL }, { 0xfea126b7d78186bcULL, 0xe2f610c84987bfa8ULL },
+    { 0x9f24b832e6b0f436ULL, 0x0dd9ca7d2df4d7c9ULL }, { 0xc6ede63fa05d3143ULL, 0x91503d1c79720dbbULL },
+    { 0xf8a95fcf88747d94ULL, 0x75a44c6397ce912aULL }, { 0x9b69dbe1b548ce7cULL, 0xc986afbe3ee11abaULL },
+    { 0xc24452da229b021bULL, 0xfbe85badce996168ULL }, { 0xf2d56790ab41c2a2ULL, 0xfae27299423fb9c3ULL },
+    { 0x97c560ba6b0919a5ULL, 0xdccd879fc967d41aULL }, { 0xbdb6b8e905cb600fULL, 0x5400e987bbc1c920ULL },
+    { 0xed246723473e3813ULL, 0x290123e9aab23b68ULL }, { 0x9436c0760c86e30bULL, 0xf9a0b6720aaf6521ULL },
+    { 0xb94470938fa89bceULL, 0xf808e40e8d5b3e69ULL }, { 0xe7958cb87392c2c2ULL, 0xb60b1d1230b20e04ULL },
+    { 0x90bd77f3483bb9b9ULL, 0xb1c6f22b5e6f48c2ULL }, { 0xb4ecd5f01a4aa828ULL, 0x1e38aeb6360b1af3ULL },
+    { 0xe2280b6c20dd5232ULL, 0x25c6da63c38de1b0ULL }, { 0x8d590723948a535fULL, 0x579c487e5a38ad0eULL },
+    { 0xb0af48ec79ace837ULL, 0x2d835a9df0c6d851ULL }, { 0xdcdb1b2798182244ULL, 0xf8e431456cf88e65ULL },
+    { 0x8a08f0f8bf0f156bULL, 0x1b8e9ecb641b58ffULL }, { 0xac8b2d36eed2dac5ULL, 0xe272467e3d222f3fULL },
+    { 0xd7adf884aa879177ULL, 0x5b0ed81dcc6abb0fULL }, { 0x86ccbb52ea94baeaULL, 0x98e947129fc2b4e9ULL },
+    { 0xa87fea27a539e9a5ULL, 0x3f2398d747b36224ULL }, { 0xd29fe4b18e88640eULL, 0x8eec7f0d19a03aadULL },
+    { 0x83a3eeeef9153e89ULL, 0x1953cf68300424acULL }, { 0xa48ceaaab75a8e2bULL, 0x5fa8c3423c052dd7ULL },
+    { 0xcdb02555653131b6ULL, 0x3792f412cb06794dULL }, { 0x808e17555f3ebf11ULL, 0xe2bbd88bbee40bd0ULL },
+    { 0xa0b19d2ab70e6ed6ULL, 0x5b6aceaeae9d0ec4ULL }, { 0xc8de047564d20a8bULL, 0xf245825a5a445275ULL },
+    { 0xfb158592be068d2eULL, 0xeed6e2f0f0d56712ULL }, { 0x9ced737bb6c4183dULL, 0x55464dd69685606bULL },
+    { 0xc428d05aa4751e4cULL, 0xaa97e14c3c26b886ULL }, { 0xf53304714d9265dfULL, 0xd53dd99f4b3066a8ULL },
+    { 0x993fe2c6d07b7fabULL, 0xe546a8038efe4029ULL }, { 0xbf8fdb78849a5f96ULL, 0xde98520472bdd033ULL },
+    { 0xef73d256a5c0f77cULL, 0x963e66858f6d4440ULL }, { 0x95a8637627989aadULL, 0xdde7001379a44aa8ULL },
+    { 0xbb127c53b17ec159ULL, 0x5560c018580d5d52ULL }, { 0xe9d71b689dde71afULL, 0xaab8f01e6e10b4a6ULL },
+    { 0x9226712162ab070dULL, 0xcab3961304ca70e8ULL }, { 0xb6b00d69bb55c8d1ULL, 0x3d607b97c5fd0d22ULL },
+    { 0xe45c10c42a2b3b05ULL, 0x8cb89a7db77c506aULL }, { 0x8eb98a7a9a5b04e3ULL, 0x77f3608e92adb242ULL },
+    { 0xb267ed1940f1c61cULL, 0x55f038b237591ed3ULL }, { 0xdf01e85f912e37a3ULL, 0x6b6c46dec52f6688ULL },
+    { 0x8b61313bbabce2c6ULL, 0x2323ac4b3b3da015ULL }, { 0xae397d8aa96c1b77ULL, 0xabec975e0a0d081aULL },
+    { 0xd9c7dced53c72255ULL, 0x96e7bd358c904a21ULL }, { 0x881cea14545c7575ULL, 0x7e50d64177da2e54ULL },
+    { 0xaa242499697392d2ULL, 0xdde50bd1d5d0b9e9ULL }, { 0xd4ad2dbfc3d07787ULL, 0x955e4ec64b44e864ULL },
+    { 0x84ec3c97da624ab4ULL, 0xbd5af13bef0b113eULL }, { 0xa6274bbdd0fadd61ULL, 0xecb1ad8aeacdd58eULL },
+    { 0xcfb11ead453994baULL, 0x67de18eda5814af2ULL }, { 0x81ceb32c4b43fcf4ULL, 0x80eacf948770ced7ULL },
+    { 0xa2425ff75e14fc31ULL, 0xa1258379a94d028dULL }, { 0xcad2f7f5359a3b3eULL, 0x096ee45813a04330ULL },
+    { 0xfd87b5f28300ca0dULL, 0x8bca9d6e188853fcULL }, { 0x9e74d1b791e07e48ULL, 0x775ea264cf55347eULL },
+    { 0xc612062576589ddaULL, 0x95364afe032a819eULL }, { 0xf79687aed3eec551ULL, 0x3a83ddbd83f52205ULL },
+    { 0x9abe14cd44753b52ULL, 0xc4926a9672793543ULL }, { 0xc16d9a0095928a27ULL, 0x75b7053c0f178294ULL },
+    { 0xf1c90080baf72cb1ULL, 0x5324c68b12dd6339ULL }, { 0x971da05074da7beeULL, 0xd3f6fc16ebca5e04ULL },
+    { 0xbce5086492111aeaULL, 0x88f4bb1ca6bcf585ULL }, { 0xec1e4a7db69561a5ULL, 0x2b31e9e3d06c32e6ULL },
+    { 0x9392ee8e921d5d07ULL, 0x3aff322e62439fd0ULL }, { 0xb877aa3236a4b449ULL, 0x09befeb9fad487c3ULL },
+    { 0xe69594bec44de15bULL, 0x4c2ebe687989a9b4ULL }, { 0x901d7cf73ab0acd9ULL, 0x0f9d37014bf60a11ULL },
+    { 0xb424dc35095cd80fULL, 0x538484c19ef38c95ULL }, { 0xe12e13424bb40e13ULL, 0x2865a5f206b06fbaULL },
+    { 0x8cbccc096f5088cbULL, 0xf93f87b7442e45d4ULL }, { 0xafebff0bcb24aafeULL, 0xf78f69a51539d749ULL },
+    { 0xdbe6fecebdedd5beULL, 0xb573440e5a884d1cULL }, { 0x89705f4136b4a597ULL, 0x31680a88f8953031ULL },
+    { 0xabcc77118461cefcULL, 0xfdc20d2b36ba7c3eULL }, { 0xd6bf94d5e57a42bcULL, 0x3d32907604691b4dULL },
+    { 0x8637bd05af6c69b5ULL, 0xa63f9a49c2c1b110ULL }, { 0xa7c5ac471b478423ULL, 0x0fcf80dc33721d54ULL },
+    { 0xd1b71758e219652bULL, 0xd3c36113404ea4a9ULL }, { 0x83126e978d4fdf3bULL, 0x645a1cac083126eaULL },
+    { 0xa3d70a3d70a3d70aULL, 0x3d70a3d70a3d70a4ULL }, { 0xccccccccccccccccULL, 0xcccccccccccccccdULL },
+    { 0x8000000000000000ULL, 0x0000000000000000ULL }, { 0xa000000000000000ULL, 0x0000000000000000ULL },
+    { 0xc800000000000000ULL, 0x0000000000000000ULL }, { 0xfa00000000000000ULL, 0x0000000000000000ULL },
+    { 0x9c40000000000000ULL, 0x0000000000000000ULL }, { 0xc350000000000000ULL, 0x0000000000000000ULL },
+    { 0xf424000000000000ULL, 0x0000000000000000ULL }, { 0x9896800000000000ULL, 0x0000000000000000ULL },
+    { 0xbebc200000000000ULL, 0x0000000000000000ULL }, { 0xee6b280000000000ULL, 0x0000000000000000ULL },
+    { 0x9502f90000000000ULL, 0x0000000000000000ULL }, { 0xba43b74000000000ULL, 0x0000000000000000ULL },
+    { 0xe8d4a51000000000ULL, 0x0000000000000000ULL }, { 0x9184e72a00000000ULL, 0x0000000000000000ULL },
+    { 0xb5e620f480000000ULL, 0x0000000000000000ULL }, { 0xe35fa931a0000000ULL, 0x0000000000000000ULL },
+    { 0x8e1bc9bf04000000ULL, 0x0000000000000000ULL }, { 0xb1a2bc2ec5000000ULL, 0x0000000000000000ULL },
+    { 0xde0b6b3a76400000ULL, 0x0000000000000000ULL }, { 0x8ac7230489e80000ULL, 0x0000000000000000ULL },
+    { 0xad78ebc5ac620000ULL, 0x0000000000000000ULL }, { 0xd8d726b7177a8000ULL, 0x0000000000000000ULL },
+    { 0x878678326eac9000ULL, 0x0000000000000000ULL }, { 0xa968163f0a57b400ULL, 0x0000000000000000ULL },
+    { 0xd3c21bcecceda100ULL, 0x0000000000000000ULL }, { 0x84595161401484a0ULL, 0x0000000000000000ULL },
+    { 0xa56fa5b99019a5c8ULL, 0x0000000000000000ULL }, { 0xcecb8f27f4200f3aULL, 0x0000000000000000ULL },
+    { 0x813f3978f8940984ULL, 0x4000000000000000ULL }, { 0xa18f07d736b90be5ULL, 0x5000000000000000ULL },
+    { 0xc9f2c9cd04674edeULL, 0xa400000000000000ULL }, { 0xfc6f7c4045812296ULL, 0x4d00000000000000ULL },
+    { 0x9dc5ada82b70b59dULL, 0xf020000000000000ULL }, { 0xc5371912364ce305ULL, 0x6c28000000000000ULL },
+    { 0xf684df56c3e01bc6ULL, 0xc732000000000000ULL }, { 0x9a130b963a6c115cULL, 0x3c7f400000000000ULL },
+    { 0xc097ce7bc90715b3ULL, 0x4b9f100000000000ULL }, { 0xf0bdc21abb48db20ULL, 0x1e86d40000000000ULL },
+    { 0x96769950b50d88f4ULL, 0x1314448000000000ULL }, { 0xbc143fa4e250eb31ULL, 0x17d955a000000000ULL },
+    { 0xeb194f8e1ae525fdULL, 0x5dcfab0800000000ULL }, { 0x92efd1b8d0cf37beULL, 0x5aa1cae500000000ULL },
+    { 0xb7abc627050305adULL, 0xf14a3d9e40000000ULL }, { 0xe596b7b0c643c719ULL, 0x6d9ccd05d0000000ULL },
+    { 0x8f7e32ce7bea5c6fULL, 0xe4820023a2000000ULL }, { 0xb35dbf821ae4f38bULL, 0xdda2802c8a800000ULL },
+    { 0xe0352f62a19e306eULL, 0xd50b2037ad200000ULL }, { 0x8c213d9da502de45ULL, 0x4526f422cc340000ULL },
+    { 0xaf298d050e4395d6ULL, 0x9670b12b7f410000ULL }, { 0xdaf3f04651d47b4cULL, 0x3c0cdd765f114000ULL },
+    { 0x88d8762bf324cd0fULL, 0xa5880a69fb6ac800ULL }, { 0xab0e93b6efee0053ULL, 0x8eea0d047a457a00ULL },
+    { 0xd5d238a4abe98068ULL, 0x72a4904598d6d880ULL }, { 0x85a36366eb71f041ULL, 0x47a6da2b7f864750ULL },
+    { 0xa70c3c40a64e6c51ULL, 0x999090b65f67d924ULL }, { 0xd0cf4b50cfe20765ULL, 0xfff4b4e3f741cf6dULL },
+    { 0x82818f1281ed449fULL, 0xbff8f10e7a8921a4ULL }, { 0xa321f2d7226895c7ULL, 0xaff72d52192b6a0dULL },
+    { 0xcbea6f8ceb02bb39ULL, 0x9bf4f8a69f764490ULL }, { 0xfee50b7025c36a08ULL, 0x02f236d04753d5b4ULL },
+    { 0x9f4f2726179a2245ULL, 0x01d762422c946590ULL }, { 0xc722f0ef9d80aad6ULL, 0x424d3ad2b7b97ef5ULL },
+    { 0xf8ebad2b84e0d58bULL, 0xd2e0898765a7deb2ULL }, { 0x9b934c3b330c8577ULL, 0x63cc55f49f88eb2fULL },
+    { 0xc2781f49ffcfa6d5ULL, 0x3cbf6b71c76b25fbULL }, { 0xf316271c7fc3908aULL, 0x8bef464e3945ef7aULL },
+    { 0x97edd871cfda3a56ULL, 0x97758bf0e3cbb5acULL }, { 0xbde94e8e43d0c8ecULL, 0x3d52eeed1cbea317ULL },
+    { 0xed63a231d4c4fb27ULL, 0x4ca7aaa863ee4bddULL }, { 0x945e455f24fb1cf8ULL, 0x8fe8caa93e74ef6aULL },
+    { 0xb975d6b6ee39e436ULL, 0xb3e2fd538e122b44ULL }, { 0xe7d34c64a9c85d44ULL, 0x60dbbca87196b616ULL },
+    { 0x90e40fbeea1d3a4aULL, 0xbc8955e946fe31cdULL }, { 0xb51d13aea4a488ddULL, 0x6babab6398bdbe41ULL },
+    { 0xe264589a4dcdab14ULL, 0xc696963c7eed2dd1ULL }, { 0x8d7eb76070a08aecULL, 0xfc1e1de5cf543ca2ULL },
+    { 0xb0de65388cc8ada8ULL, 0x3b25a55f43294bcbULL }, { 0xdd15fe86affad912ULL, 0x49ef0eb713f39ebeULL },
+    { 0x8a2dbf142dfcc7abULL, 0x6e3569326c784337ULL }, { 0xacb92ed9397bf996ULL, 0x49c2c37f07965404ULL },
+    { 0xd7e77a8f87daf7fbULL, 0xdc33745ec97be906ULL }, { 0x86f0ac99b4e8dafdULL, 0x69a028bb3ded71a3ULL },
+    { 0xa8acd7c0222311bcULL, 0xc40832ea0d68ce0cULL }, { 0xd2d80db02aabd62bULL, 0xf50a3fa490c30190ULL },
+    { 0x83c7088e1aab65dbULL, 0x792667c6da79e0faULL }, { 0xa4b8cab1a1563f52ULL, 0x577001b891185938ULL },
+    { 0xcde6fd5e09abcf26ULL, 0xed4c0226b55e6f86ULL }, { 0x80b05e5ac60b6178ULL, 0x544f8158315b05b4ULL },
+    { 0xa0dc75f1778e39d6ULL, 0x696361ae3db1c721ULL }, { 0xc913936dd571c84cULL, 0x03bc3a19cd1e38e9ULL },
+    { 0xfb5878494ace3a5fULL, 0x04ab48a04065c723ULL }, { 0x9d174b2dcec0e47bULL, 0x62eb0d64283f9c76ULL },
+    { 0xc45d1df942711d9aULL, 0x3ba5d0bd324f8394ULL }, { 0xf5746577930d6500ULL, 0xca8f44ec7ee36479ULL },
+    { 0x9968bf6abbe85f20ULL, 0x7e998b13cf4e1ecbULL }, { 0xbfc2ef456ae276e8ULL, 0x9e3fedd8c321a67eULL },
+    { 0xefb3ab16c59b14a2ULL, 0xc5cfe94ef3ea101eULL }, { 0x95d04aee3b80ece5ULL, 0xbba1f1d158724a12ULL },
+    { 0xbb445da9ca61281fULL, 0x2a8a6e45ae8edc97ULL }, { 0xea1575143cf97226ULL, 0xf52d09d71a3293bdULL },
+    { 0x924d692ca61be758ULL, 0x593c2626705f9c56ULL }, { 0xb6e0c377cfa2e12eULL, 0x6f8b2fb00c77836cULL },
+    { 0xe498f455c38b997aULL, 0x0b6dfb9c0f956447ULL }, { 0x8edf98b59a373fecULL, 0x4724bd4189bd5eacULL },
+    { 0xb2977ee300c50fe7ULL, 0x58edec91ec2cb657ULL }, { 0xdf3d5e9bc0f653e1ULL, 0x2f2967b66737e3edULL },
+    { 0x8b865b215899f46cULL, 0xbd79e0d20082ee74ULL }, { 0xae67f1e9aec07187ULL, 0xecd8590680a3aa11ULL },
+    { 0xda01ee641a708de9ULL, 0xe80e6f4820cc9495ULL }, { 0x884134fe908658b2ULL, 0x3109058d147fdcddULL },
+    { 0xaa51823e34a7eedeULL, 0xbd4b46f0599fd415ULL }, { 0xd4e5e2cdc1d1ea96ULL, 0x6c9e18ac7007c91aULL },
+    { 0x850fadc09923329eULL, 0x03e2cf6bc604ddb0ULL }, { 0xa6539930bf6bff45ULL, 0x84db8346b786151cULL },
+    { 0xcfe87f7cef46ff16ULL, 0xe612641865679a63ULL }, { 0x81f14fae158c5f6eULL, 0x4fcb7e8f3f60c07eULL },
+    { 0xa26da3999aef7749ULL, 0xe3be5e330f38f09dULL }, { 0xcb090c8001ab551cULL, 0x5cadf5bfd3072cc5ULL },
+    { 0xfdcb4fa002162a63ULL, 0x73d9732fc7c8f7f6ULL }, { 0x9e9f11c4014dda7eULL, 0x2867e7fddcdd9afaULL },
+    { 0xc646d63501a1511dULL, 0xb281e1fd541501b8ULL }, { 0xf7d88bc24209a565ULL, 0x1f225a7ca91a4226ULL },
+    { 0x9ae757596946075fULL, 0x3375788de9b06958ULL }, { 0xc1a12d2fc3978937ULL, 0x0052d6b1641c83aeULL },
+    { 0xf209787bb47d6b84ULL, 0xc0678c5dbd23a49aULL }, { 0x9745eb4d50ce6332ULL, 0xf840b7ba963646e0ULL },
+    { 0xbd176620a501fbffULL, 0xb650e5a93bc3d898ULL }, { 0xec5d3fa8ce427affULL, 0xa3e51f138ab4cebeULL },
+    { 0x93ba47c980e98cdfULL, 0xc66f336c36b10137ULL }, { 0xb8a8d9bbe123f017ULL, 0xb80b0047445d4184ULL },
+    { 0xe6d3102ad96cec1dULL, 0xa60dc059157491e5ULL }, { 0x9043ea1ac7e41392ULL, 0x87c89837ad68db2fULL },
+    { 0xb454e4a179dd1877ULL, 0x29babe4598c311fbULL }, { 0xe16a1dc9d8545e94ULL, 0xf4296dd6fef3d67aULL },
+    { 0x8ce2529e2734bb1dULL, 0x1899e4a65f58660cULL }, { 0xb01ae745b101e9e4ULL, 0x5ec05dcff72e7f8fULL },
+    { 0xdc21a1171d42645dULL, 0x76707543f4fa1f73ULL }, { 0x899504ae72497ebaULL, 0x6a06494a791c53a8ULL },
+    { 0xabfa45da0edbde69ULL, 0x0487db9d17636892ULL }, { 0xd6f8d7509292d603ULL, 0x45a9d2845d3c42b6ULL },
+    { 0x865b86925b9bc5c2ULL, 0x0b8a2392ba45a9b2ULL }, { 0xa7f26836f282b732ULL, 0x8e6cac7768d7141eULL },
+    { 0xd1ef0244af2364ffULL, 0x3207d795430cd926ULL }, { 0x8335616aed761f1fULL, 0x7f44e6bd49e807b8ULL },
+    { 0xa402b9c5a8d3a6e7ULL, 0x5f16206c9c6209a6ULL }, { 0xcd036837130890a1ULL, 0x36dba887c37a8c0fULL },
+    { 0x802221226be55a64ULL, 0xc2494954da2c9789ULL }, { 0xa02aa96b06deb0fdULL, 0xf2db9baa10b7bd6cULL },
+    { 0xc83553c5c8965d3dULL, 0x6f92829494e5acc7ULL }, { 0xfa42a8b73abbf48cULL, 0xcb772339ba1f17f9ULL },
+    { 0x9c69a97284b578d7ULL, 0xff2a760414536efbULL }, { 0xc38413cf25e2d70dULL, 0xfef5138519684abaULL },
+    { 0xf46518c2ef5b8cd1ULL, 0x7eb258665fc25d69ULL }, { 0x98bf2f79d5993802ULL, 0xef2f773ffbd97a61ULL },
+    { 0xbeeefb584aff8603ULL, 0xaafb550ffacfd8faULL }, { 0xeeaaba2e5dbf6784ULL, 0x95ba2a53f983cf38ULL },
+    { 0x952ab45cfa97a0b2ULL, 0xdd945a747bf26183ULL }, { 0xba756174393d88dfULL, 0x94f971119aeef9e4ULL },
+    { 0xe912b9d1478ceb17ULL, 0x7a37cd5601aab85dULL }, { 0x91abb422ccb812eeULL, 0xac62e055c10ab33aULL },
+    { 0xb616a12b7fe617aaULL, 0x577b986b314d6009ULL }, { 0xe39c49765fdf9d94ULL, 0xed5a7e85fda0b80bULL },
+    { 0x8e41ade9fbebc27dULL, 0x14588f13be847307ULL }, { 0xb1d219647ae6b31cULL, 0x596eb2d8ae258fc8ULL },
+    { 0xde469fbd99a05fe3ULL, 0x6fca5f8ed9aef3bbULL }, { 0x8aec23d680043beeULL, 0x25de7bb9480d5854ULL },
+    { 0xada72ccc20054ae9ULL, 0xaf561aa79a10ae6aULL }, { 0xd910f7ff28069da4ULL, 0x1b2ba1518094da04ULL },
+    { 0x87aa9aff79042286ULL, 0x90fb44d2f05d0842ULL }, { 0xa99541bf57452b28ULL, 0x353a1607ac744a53ULL },
+    { 0xd3fa922f2d1675f2ULL, 0x42889b8997915ce8ULL }, { 0x847c9b5d7c2e09b7ULL, 0x69956135febada11ULL },
+    { 0xa59bc234db398c25ULL, 0x43fab9837e699095ULL }, { 0xcf02b2c21207ef2eULL, 0x94f967e45e03f4bbULL },
+    { 0x8161afb94b44f57dULL, 0x1d1be0eebac278f5ULL }, { 0xa1ba1ba79e1632dcULL, 0x6462d92a69731732ULL },
+    { 0xca28a291859bbf93ULL, 0x7d7b8f7503cfdcfeULL }, { 0xfcb2cb35e702af78ULL, 0x5cda735244c3d43eULL },
+    { 0x9defbf01b061adabULL, 0x3a0888136afa64a7ULL }, { 0xc56baec21c7a1916ULL, 0x088aaa1845b8fdd0ULL },
+    { 0xf6c69a72a3989f5bULL, 0x8aad549e57273d45ULL }, { 0x9a3c2087a63f6399ULL, 0x36ac54e2f678864bULL },
+    { 0xc0cb28a98fcf3c7fULL, 0x84576a1bb416a7ddULL }, { 0xf0fdf2d3f3c30b9fULL, 0x656d44a2a11c51d5ULL },
+    { 0x969eb7c47859e743ULL, 0x9f644ae5a4b1b325ULL }, { 0xbc4665b596706114ULL, 0x873d5d9f0dde1feeULL },
+    { 0xeb57ff22fc0c7959ULL, 0xa90cb506d155a7eaULL }, { 0x9316ff75dd87cbd8ULL, 0x09a7f12442d588f2ULL },
+    { 0xb7dcbf5354e9beceULL, 0x0c11ed6d538aeb2fULL }, { 0xe5d3ef282a242e81ULL, 0x8f1668c8a86da5faULL },
+    { 0x8fa475791a569d10ULL, 0xf96e017d694487bcULL }, { 0xb38d92d760ec4455ULL, 0x37c981dcc395a9acULL },
+    { 0xe070f78d3927556aULL, 0x85bbe253f47b1417ULL }, { 0x8c469ab843b89562ULL, 0x93956d7478ccec8eULL },
+    { 0xaf58416654a6babbULL, 0x387ac8d1970027b2ULL }, { 0xdb2e51bfe9d0696aULL, 0x06997b05fcc0319eULL },
+    { 0x88fcf317f22241e2ULL, 0x441fece3bdf81f03ULL }, { 0xab3c2fddeeaad25aULL, 0xd527e81cad7626c3ULL },
+    { 0xd60b3bd56a5586f1ULL, 0x8a71e223d8d3b074ULL }, { 0x85c7056562757456ULL, 0xf6872d5667844e49ULL },
+    { 0xa738c6bebb12d16cULL, 0xb428f8ac016561dbULL }, { 0xd106f86e69d785c7ULL, 0xe13336d701beba52ULL },
+    { 0x82a45b450226b39cULL, 0xecc0024661173473ULL }, { 0xa34d721642b06084ULL, 0x27f002d7f95d0190ULL },
+    { 0xcc20ce9bd35c78a5ULL, 0x31ec038df7b441f4ULL }, { 0xff290242c83396ceULL, 0x7e67047175a15271ULL },
+    { 0x9f79a169bd203e41ULL, 0x0f0062c6e984d386ULL }, { 0xc75809c42c684dd1ULL, 0x52c07b78a3e60868ULL },
+    { 0xf92e0c3537826145ULL, 0xa7709a56ccdf8a82ULL }, { 0x9bbcc7a142b17ccbULL, 0x88a66076400bb691ULL },
+    { 0xc2abf989935ddbfeULL, 0x6acff893d00ea435ULL }, { 0xf356f7ebf83552feULL, 0x0583f6b8c4124d43ULL },
+    { 0x98165af37b2153deULL, 0xc3727a337a8b704aULL }, { 0xbe1bf1b059e9a8d6ULL, 0x744f18c0592e4c5cULL },
+    { 0xeda2ee1c7064130cULL, 0x1162def06f79df73ULL }, { 0x9485d4d1c63e8be7ULL, 0x8addcb5645ac2ba8ULL },
+    { 0xb9a74a0637ce2ee1ULL, 0x6d953e2bd7173692ULL }, { 0xe8111c87c5c1ba99ULL, 0xc8fa8db6ccdd0437ULL },
+    { 0x910ab1d4db9914a0ULL, 0x1d9c9892400a22a2ULL }, { 0xb54d5e4a127f59c8ULL, 0x2503beb6d00cab4bULL },
+    { 0xe2a0b5dc971f303aULL, 0x2e44ae64840fd61dULL }, { 0x8da471a9de737e24ULL, 0x5ceaecfed289e5d2ULL },
+    { 0xb10d8e1456105dadULL, 0x7425a83e872c5f47ULL }, { 0xdd50f1996b947518ULL, 0xd12f124e28f77719ULL },
+    { 0x8a5296ffe33cc92fULL, 0x82bd6b70d99aaa6fULL }, { 0xace73cbfdc0bfb7bULL, 0x636cc64d1001550bULL },
+    { 0xd8210befd30efa5aULL, 0x3c47f7e05401aa4eULL }, { 0x8714a775e3e95c78ULL, 0x65acfaec34810a71ULL },
+    { 0xa8d9d1535ce3b396ULL, 0x7f1839a741a14d0dULL }, { 0xd31045a8341ca07cULL, 0x1ede48111209a050ULL },
+    { 0x83ea2b892091e44dULL, 0x934aed0aab460432ULL }, { 0xa4e4b66b68b65d60ULL, 0xf81da84d5617853fULL },
+    { 0xce1de40642e3f4b9ULL, 0x36251260ab9d668eULL }, { 0x80d2ae83e9ce78f3ULL, 0xc1d72b7c6b426019ULL },
+    { 0xa1075a24e4421730ULL, 0xb24cf65b8612f81fULL }, { 0xc94930ae1d529cfcULL, 0xdee033f26797b627ULL },
+    { 0xfb9b7cd9a4a7443cULL, 0x169840ef017da3b1ULL }, { 0x9d412e0806e88aa5ULL, 0x8e1f289560ee864eULL },
+    { 0xc491798a08a2ad4eULL, 0xf1a6f2bab92a27e2ULL }, { 0xf5b5d7ec8acb58a2ULL, 0xae10af696774b1dbULL },
+    { 0x9991a6f3d6bf1765ULL, 0xacca6da1e0a8ef29ULL }, { 0xbff610b0cc6edd3fULL, 0x17fd090a58d32af3ULL },
+    { 0xeff394dcff8a948eULL, 0xddfc4b4cef07f5b0ULL }, { 0x95f83d0a1fb69cd9ULL, 0x4abdaf101564f98eULL },
+    { 0xbb764c4ca7a4440fULL, 0x9d6d1ad41abe37f1ULL }, { 0xea53df5fd18d5513ULL, 0x84c86189216dc5edULL },
+    { 0x92746b9be2f8552cULL, 0x32fd3cf5b4e49bb4ULL }, { 0xb7118682dbb66a77ULL, 0x3fbc8c33221dc2a1ULL },
+    { 0xe4d5e82392a40515ULL, 0x0fabaf3feaa5334aULL }, { 0x8f05b1163ba6832dULL, 0x29cb4d87f2a7400eULL },
+    { 0xb2c71d5bca9023f8ULL, 0x743e20e9ef511012ULL }, { 0xdf78e4b2bd342cf6ULL, 0x914da9246b255416ULL },
+    { 0x8bab8eefb6409c1aULL, 0x1ad089b6c2f7548eULL }, { 0xae9672aba3d0c320ULL, 0xa184ac2473b529b1ULL },
+    { 0xda3c0f568cc4f3e8ULL, 0xc9e5d72d90a2741eULL }, { 0x8865899617fb1871ULL, 0x7e2fa67c7a658892ULL },
+    { 0xaa7eebfb9df9de8dULL, 0xddbb901b98feeab7ULL }, { 0xd51ea6fa85785631ULL, 0x552a74227f3ea565ULL },
+    { 0x8533285c936b35deULL, 0xd53a88958f87275fULL }, { 0xa67ff273b8460356ULL, 0x8a892abaf368f137ULL },
+    { 0xd01fef10a657842cULL, 0x2d2b7569b0432d85ULL }, { 0x8213f56a67f6b29bULL, 0x9c3b29620e29fc73ULL },
+    { 0xa298f2c501f45f42ULL, 0x8349f3ba91b47b8fULL }, { 0xcb3f2f7642717713ULL, 0x241c70a936219a73ULL },
+    { 0xfe0efb53d30dd4d7ULL, 0xed238cd383aa0110ULL }, { 0x9ec95d1463e8a506ULL, 0xf4363804324a40aaULL },
+    { 0xc67bb4597ce2ce48ULL, 0xb143c6053edcd0d5ULL }, { 0xf81aa16fdc1b81daULL, 0xdd94b7868e94050aULL },
+    { 0x9b10a4e5e9913128ULL, 0xca7cf2b4191c8326ULL }, { 0xc1d4ce1f63f57d72ULL, 0xfd1c2f611f63a3f0ULL },
+    { 0xf24a01a73cf2dccfULL, 0xbc633b39673c8cecULL }, { 0x976e41088617ca01ULL, 0xd5be0503e085d813ULL },
+    { 0xbd49d14aa79dbc82ULL, 0x4b2d8644d8a74e18ULL }, { 0xec9c459d51852ba2ULL, 0xddf8e7d60ed1219eULL },
+    { 0x93e1ab8252f33b45ULL, 0xcabb90e5c942b503ULL }, { 0xb8da1662e7b00a17ULL, 0x3d6a751f3b936243ULL },
+    { 0xe7109bfba19c0c9dULL, 0x0cc512670a783ad4ULL }, { 0x906a617d450187e2ULL, 0x27fb2b80668b24c5ULL },
+    { 0xb484f9dc9641e9daULL, 0xb1f9f660802dedf6ULL }, { 0xe1a63853bbd26451ULL, 0x5e7873f8a0396973ULL },
+    { 0x8d07e33455637eb2ULL, 0xdb0b487b6423e1e8ULL }, { 0xb049dc016abc5e5fULL, 0x91ce1a9a3d2cda62ULL },
+    { 0xdc5c5301c56b75f7ULL, 0x7641a140cc7810fbULL }, { 0x89b9b3e11b6329baULL, 0xa9e904c87fcb0a9dULL },
+    { 0xac2820d9623bf429ULL, 0x546345fa9fbdcd44ULL }, { 0xd732290fbacaf133ULL, 0xa97c177947ad4095ULL },
+    { 0x867f59a9d4bed6c0ULL, 0x49ed8eabcccc485dULL }, { 0xa81f301449ee8c70ULL, 0x5c68f256bfff5a74ULL },
+    { 0xd226fc195c6a2f8cULL, 0x73832eec6fff3111ULL }, { 0x83585d8fd9c25db7ULL, 0xc831fd53c5ff7eabULL },
+    { 0xa42e74f3d032f525ULL, 0xba3e7ca8b77f5e55ULL }, { 0xcd3a1230c43fb26fULL, 0x28ce1bd2e55f35ebULL },
+    { 0x80444b5e7aa7cf85ULL, 0x7980d163cf5b81b3ULL }, { 0xa0555e361951c366ULL, 0xd7e105bcc332621fULL },
+    { 0xc86ab5c39fa63440ULL, 0x8dd9472bf3fefaa7ULL }, { 0xfa856334878fc150ULL, 0xb14f98f6f0feb951ULL },
+    { 0x9c935e00d4b9d8d2ULL, 0x6ed1bf9a569f33d3ULL }, { 0xc3b8358109e84f07ULL, 0x0a862f80ec4700c8ULL },
+    { 0xf4a642e14c6262c8ULL, 0xcd27bb612758c0faULL }, { 0x98e7e9cccfbd7dbdULL, 0x8038d51cb897789cULL },
+    { 0xbf21e44003acdd2cULL, 0xe0470a63e6bd56c3ULL }, { 0xeeea5d5004981478ULL, 0x1858ccfce06cac74ULL },
+    { 0x95527a5202df0ccbULL, 0x0f37801e0c43ebc8ULL }, { 0xbaa718e68396cffdULL, 0xd30560258f54e6baULL },
+    { 0xe950df20247c83fdULL, 0x47c6b82ef32a2069ULL }, { 0x91d28b7416cdd27eULL, 0x4cdc331d57fa5441ULL },
+    { 0xb6472e511c81471dULL, 0xe0133fe4adf8e952ULL }, { 0xe3d8f9e563a198e5ULL, 0x58180fddd97723a6ULL },
+    { 0x8e679c2f5e44ff8fULL, 0x570f09eaa7ea7648ULL },
+};
+
+/// Powers of ten that are exact doubles (Clinger fast path)
+const double EXACT_POWER_OF_TEN[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+inline Uint128 multiply64( uint64_t a, uint64_t b ) noexcept
+{
+#if defined( __SIZEOF_INT128__ )
+    const unsigned __int128 r = static_cast<unsigned __int128>( a ) * b;
+    return Uint128{ static_cast<uint64_t>( r >> 64 ), static_cast<uint64_t>( r ) };
+#else
+    const uint64_t aLo = uint32_t( a ), aHi = a >> 32;
+    const uint64_t bLo = uint32_t( b ), bHi = b >> 32;
+    const uint64_t ll  = aLo * bLo, lh = aLo * bHi, hl = aHi * bLo, hh = aHi * bHi;
+    const uint64_t mid = ( ll >> 32 ) + uint32_t( lh ) + uint32_t( hl );
+    return Uint128{ hh + ( lh >> 32 ) + ( hl >> 32 ) + ( mid >> 32 ), ( mid << 32 ) | uint32_t( ll ) };
+#endif
 }
 
-Json JsonObject( const std::string& key, const Json& jsValue )
+inline int countLeadingZeros( uint64_t x ) noexcept
 {
-    return JsonObject().addObject( key, jsValue );
+#if defined( __GNUC__ )
+    return __builtin_clzll( x );
+#else
+    int n = 0;
+    while( !( x & ( uint64_t( 1 ) << 63 ) ) ) { x <<= 1; ++n; }
+    return n;
+#endif
 }
 
-Json JsonArray()
+/**
+ * @brief Eisel-Lemire: the IEEE-754 bits of w * 10^q (w > 0), correctly
+ * rounded to nearest-even.
+ */
+uint64_t eiselLemire( uint64_t w, int q ) noexcept
 {
-    return Json( JsonType::ARRAY );
+    const uint64_t INFINITY_BITS = 0x7FF0000000000000ULL;
+    const int      MANTISSA_BITS = 52;
+
+    if( w == 0 || q < SMALLEST_POWER_OF_TEN ) return 0;
+    if( q > LARGEST_POWER_OF_TEN )            return INFINITY_BITS;
+
+    const int lz = countLeadingZeros( w );
+    w <<= lz;
+
+    // High 64 bits of w * 5^q; the low word is only needed when the bits
+    // below the mantissa are all ones (a carry may still come in)
+    const Uint128& pow5    = POWER_OF_FIVE_128[q - SMALLEST_POWER_OF_TEN];
+    Uint128        product = multiply64( w, pow5.high );
+    if( ( product.high & 0x1FF ) == 0x1FF )
+    {
+        const Uint128 second = multiply64( w, pow5.low );
+        product.low += second.high;
+        if( second.high > product.low ) ++product.high;
+    }
+
+    const int upperBit = static_cast<int>( product.high >> 63 );
+    const int shift    = upperBit + 64 - MANTISSA_BITS - 3;
+    uint64_t  mantissa = product.high >> shift;
+    // floor(log2(10^q)) + 63, then rebias (1023)
+    int power2 = ( ( ( 152170 + 65536 ) * q ) >> 16 ) + 63 + upperBit - lz + 1023;
+
+    if( power2 <= 0 ) // subnormal (or zero)
+    {
+        if( -power2 + 1 >= 64 ) return 0;
+        mantissa >>= -power2 + 1;
+        mantissa += ( mantissa & 1 );
+        mantissa >>= 1;
+        // Rounding may carry into the smallest normal exponent
+        power2 = ( mantissa < ( uint64_t( 1 ) << MANTISSA_BITS ) ) ? 0 : 1;
+        return mantissa | ( uint64_t( power2 ) << MANTISSA_BITS );
+    }
+
+    // Exactly halfway (only possible when 5^q fits in 64 bits): round to even
+    if( product.low <= 1 && q >= -4 && q <= 23 && ( mantissa & 3 ) == 1 &&
+        ( mantissa << shift ) == product.high )
+    {
+        mantissa &= ~uint64_t( 1 );
+    }
+
+    mantissa += ( mantissa & 1 );
+    mantissa >>= 1;
+    if( mantissa >= ( uint64_t( 2 ) << MANTISSA_BITS ) ) {
+        mantissa = uint64_t( 1 ) << MANTISSA_BITS;
+        ++power2;
+    }
+    mantissa &= ~( uint64_t( 1 ) << MANTISSA_BITS );
+
+    if( power2 >= 0x7FF ) return INFINITY_BITS;
+    return mantissa | ( uint64_t( power2 ) << MANTISSA_BITS );
 }
 
-Json JsonNULL()
+inline double bitsToDouble( uint64_t bits ) noexcept
 {
-    return Json( JsonType::NULL_TYPE );
+    double d;
+    std::memcpy( &d, &bits, sizeof( d ) );
+    return d;
+}
+
+/**
+ * @brief Converts a JSON number (already validated by the grammar) to the
+ * nearest double.
+ */
+double parseDouble( const char* s, std::size_t n ) noexcept
+{
+    const char* p   = s;
+    const char* end = s + n;
+
+    const bool negative = ( p < end && *p == '-' );
+    if( negative ) ++p;
+
+    // First 19 significant digits in w, the rest only shift the exponent
+    uint64_t  w         = 0;
+    int       digits    = 0;
+    long long exponent  = 0;
+    bool      truncated = false;
+
+    auto digit = [&]( int d, bool fraction ) {
+        if( digits == 0 && d == 0 ) {           // leading zero
+            if( fraction ) --exponent;
+        } else if( digits < 19 ) {
+            w = w * 10 + static_cast<uint64_t>( d );
+            ++digits;
+            if( fraction ) --exponent;
+        } else {
+            truncated |= ( d != 0 );
+            if( !fraction ) ++exponent;
+        }
+    };
+
+    for( ; p < end && *p >= '0' && *p <= '9'; ++p ) digit( *p - '0', false );
+    if( p < end && *p == '.' ) {
+        for( ++p; p < end && *p >= '0' && *p <= '9'; ++p ) digit( *p - '0', true );
+    }
+    if( p < end && ( *p == 'e' || *p == 'E' ) )
+    {
+        ++p;
+        const bool negExp = ( p < end && *p == '-' );
+        if( p < end && ( *p == '-' || *p == '+' ) ) ++p;
+
+        long long e = 0;
+        for( ; p < end && *p >= '0' && *p <= '9'; ++p ) {
+            if( e < 100000 ) e = e * 10 + ( *p - '0' ); // far beyond any double
+        }
+        exponent += negExp ? -e : e;
+    }
+
+    double value;
+    if( w == 0 ) {
+        value = 0.0;
+    }
+    else if( !truncated && w <= ( uint64_t( 1 ) << 53 ) && exponent >= -22 && exponent <= 22 ) {
+        // Clinger: both operands exact, so one rounding
+        value = static_cast<double>( w );
+        value = ( exponent < 0 ) ? value / EXACT_POWER_OF_TEN[-exponent]
+                                 : value * EXACT_POWER_OF_TEN[exponent];
+    }
+    else {
+        const int q = static_cast<int>( std::max<long long>( std::min<long long>( exponent, 100000 ), -100000 ) );
+        const uint64_t bits = eiselLemire( w, q );
+
+        // Dropped digits put the true value in (w, w + 1) * 10^q
+        if( truncated && eiselLemire( w + 1, q ) != bits ) {
+            const std::string text( s, n );
+            return std::strtod( text.c_str(), nullptr );
+        }
+        value = bitsToDouble( bits );
+    }
+    return negative ? -value : value;
+}
+
+/**
+ * @brief Converts integer text to int64_t.
+ * @return false if the value does not fit (the caller falls back to double).
+ */
+bool parseInt64( const char* s, std::size_t n, int64_t& out ) noexcept
+{
+    const bool  negative = ( n > 0 && *s == '-' );
+    const char* p        = s + ( negative ? 1 : 0 );
+    const char* end      = s + n;
+
+    const uint64_t limit = negative ? uint64_t( INT64_MAX ) + 1 : uint64_t( INT64_MAX );
+    uint64_t value = 0;
+
+    for( ; p < end; ++p )
+    {
+        const uint64_t digit = static_cast<uint64_t>( *p - '0' );
+        if( value > ( limit - digit ) / 10 )
+            return false;
+        value = value * 10 + digit;
+    }
+
+    out = negative ? static_cast<int64_t>( 0 - value ) : static_cast<int64_t>( value );
+    return true;
+}
+
+/**
+ * @brief Converts non-negative integer text to uint64_t.
+ * @return false if the value does not fit.
+ */
+bool parseUInt64( const char* s, std::size_t n, uint64_t& out ) noexcept
+{
+    uint64_t value = 0;
+    for( const char* p = s; p < s + n; ++p )
+    {
+        const uint64_t digit = static_cast<uint64_t>( *p - '0' );
+        if( value > ( UINT64_MAX - digit ) / 10 )
+            return false;
+        value = value * 10 + digit;
+    }
+    out = value;
+    return true;
+}
+
+} // namespace
+
+void Json::setNumber( const char* s, std::size_t n, JsonType type )
+{
+    this->reset( type );
+
+    if( type == JsonType::INT )
+    {
+        if( parseInt64( s, n, this->val.i ) ) {
+            this->numKind = NumberKind::Int64;
+            return;
+        }
+        if( *s != '-' && parseUInt64( s, n, this->val.u ) ) {
+            this->numKind = NumberKind::UInt64;
+            return;
+        }
+        this->val.str = SharedString( StringView( s, n ) ).detach(); // keep every digit for output
+        this->numKind = NumberKind::Text;
+        return;
+    }
+    // Fractions and exponents. Beyond the double range (e.g. 1e400) the
+    // text is kept: it is written back unchanged rather than as null, and
+    // reads as an infinity.
+    this->val.d = parseDouble( s, n );
+    if( std::isinf( this->val.d ) ) {
+        this->val.str = SharedString( StringView( s, n ) ).detach();
+        this->numKind = NumberKind::Text;
+        return;
+    }
+    this->numKind = NumberKind::Double;
 }
 
 // =============================================================================
-// [Json Constructors & Destructor]
+// [Number Formatting]
 // =============================================================================
+// Integers are printed two digits at a time from a lookup table. Doubles use
+// Grisu2 (Loitsch, "Printing Floating-Point Numbers Quickly and Accurately
+// with Integers"): a 64-bit multiplication by a cached power of ten yields
+// the digits directly. The output always parses back to the same double and
+// is the shortest such string in all but a tiny fraction of cases.
 
-Json::Json() noexcept
-    : strValue( "" )
-    , jType   ( JsonType::UNKNOWN )
+namespace {
+
+const char DIGIT_PAIRS[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+/**
+ * @brief Writes the decimal digits of `v` at `out`.
+ * @return One past the last digit written.
+ */
+char* writeUnsigned( char* out, uint64_t v ) noexcept
 {
+    int digits = 1;
+    for( uint64_t t = v; t >= 10; t /= 10 ) ++digits;
+
+    char* p = out + digits;
+    while( v >= 100 ) {
+        const std::size_t pair = static_cast<std::size_t>( v % 100 ) * 2;
+        v /= 100;
+        *--p = DIGIT_PAIRS[pair + 1];
+        *--p = DIGIT_PAIRS[pair];
+    }
+    if( v >= 10 ) {
+        *--p = DIGIT_PAIRS[v * 2 + 1];
+        *--p = DIGIT_PAIRS[v * 2];
+    } else {
+        *--p = static_cast<char>( '0' + v );
+    }
+    return out + digits;
 }
 
-Json::Json( const JsonType type ) noexcept
-    : strValue( "" )
-    , jType   ( type )
+char* writeSigned( char* out, int64_t v ) noexcept
 {
-    if( this->isNull() ) this->setString( "null" );
+    if( v < 0 ) {
+        *out++ = '-';
+        return writeUnsigned( out, 0 - static_cast<uint64_t>( v ) );
+    }
+    return writeUnsigned( out, static_cast<uint64_t>( v ) );
 }
 
-// -----------------------------------------------------------------------------
-// String Constructors
-// -----------------------------------------------------------------------------
-Json::Json( const char* initVal )
+/// A floating-point value f * 2^e with a 64-bit significand
+struct DiyFp
+{
+    uint64_t f;
+    int      e;
+};
+
+inline DiyFp diySub( DiyFp x, DiyFp y ) noexcept { return DiyFp{ x.f - y.f, x.e }; }
+
+/// Upper 64 bits of the product (rounded), exponent adjusted
+inline DiyFp diyMul( DiyFp x, DiyFp y ) noexcept
 {
-    this->setType( JsonType::STRING );
-    this->setString( initVal );
+    const Uint128 p = multiply64( x.f, y.f );
+    return DiyFp{ p.high + ( p.low >> 63 ), x.e + y.e + 64 };
 }
 
-Json::Json( const std::string& initVal )
+inline DiyFp diyNormalize( DiyFp x ) noexcept
 {
-    this->setType( JsonType::STRING );
-    this->setString( initVal );
+    const int shift = countLeadingZeros( x.f );
+    return DiyFp{ x.f << shift, x.e - shift };
 }
 
-Json::Json( char initVal )
+/**
+ * @brief The value and the midpoints to its neighbours (m-, m+), all
+ * scaled to the same exponent as m+.
+ */
+struct Boundaries
 {
-    this->setType( JsonType::STRING );
-    this->setString( std::string( 1, initVal ) );
+    DiyFp w;
+    DiyFp minus;
+    DiyFp plus;
+};
+
+/// `MantissaBits` / `Bias` describe the binary format (double or float)
+template <int MantissaBits, int Bias>
+Boundaries computeBoundaries( uint64_t bits ) noexcept
+{
+    const uint64_t hiddenBit = uint64_t( 1 ) << MantissaBits;
+    const uint64_t F = bits & ( hiddenBit - 1 );
+    const int      E = static_cast<int>( bits >> MantissaBits );
+
+    const DiyFp v = ( E == 0 ) ? DiyFp{ F, 1 - Bias - MantissaBits }
+                               : DiyFp{ F + hiddenBit, E - Bias - MantissaBits };
+
+    // The gap below is half as wide at a power of two (except the smallest)
+    const bool  lowerCloser = ( F == 0 && E > 1 );
+    const DiyFp plus  = diyNormalize( DiyFp{ 2 * v.f + 1, v.e - 1 } );
+    const DiyFp minus = lowerCloser ? DiyFp{ 4 * v.f - 1, v.e - 2 } : DiyFp{ 2 * v.f - 1, v.e - 1 };
+
+    return Boundaries{ diyNormalize( v ), DiyFp{ minus.f << ( minus.e - plus.e ), plus.e }, plus };
 }
 
-// -----------------------------------------------------------------------------
-// Numeric Constructors
-// -----------------------------------------------------------------------------
-Json::Json( int initVal )
+struct CachedPower
+{
+    uint64_t f;
+    int      e;
+    int      k;
+};
+
+/// 10^k for k = -300, -292, ..., 340, as rounded 64-bit significands
+const CachedPower CACHED_POWERS[] = {
+    { 0xAB70FE17C79AC6CAULL, -1060, -300 }, { 0xFF77B1FCBEBCDC4FULL, -1034, -292 },
+    { 0xBE5691EF416BD60CULL, -1007, -284 }, { 0x8DD01FAD907FFC3CULL,  -980, -276 },
+    { 0xD3515C2831559A83ULL,  -954, -268 }, { 0x9D71AC8FADA6C9B5ULL,  -927, -260 },
+    { 0xEA9C227723EE8BCBULL,  -901, -252 }, { 0xAECC49914078536DULL,  -874, -244 },
+    { 0x823C12795DB6CE57ULL,  -847, -236 }, { 0xC21094364DFB5637ULL,  -821, -228 },
+    { 0x9096EA6F3848984FULL,  -794, -220 }, { 0xD77485CB25823AC7ULL,  -768, -212 },
+    { 0xA086CFCD97BF97F4ULL,  -741, -204 }, { 0xEF340A98172AACE5ULL,  -715, -196 },
+    { 0xB23867FB2A35B28EULL,  -688, -188 }, { 0x84C8D4DFD2C63F3BULL,  -661, -180 },
+    { 0xC5DD44271AD3CDBAULL,  -635, -172 }, { 0x936B9FCEBB25C996ULL,  -608, -164 },
+    { 0xDBAC6C247D62A584ULL,  -582, -156 }, { 0xA3AB66580D5FDAF6ULL,  -555, -148 },
+    { 0xF3E2F893DEC3F126ULL,  -529, -140 }, { 0xB5B5ADA8AAFF80B8ULL,  -502, -132 },
+    { 0x87625F056C7C4A8BULL,  -475, -124 }, { 0xC9BCFF6034C13053ULL,  -449, -116 },
+    { 0x964E858C91BA2655ULL,  -422, -108 }, { 0xDFF9772470297EBDULL,  -396, -100 },
+    { 0xA6DFBD9FB8E5B88FULL,  -369,  -92 }, { 0xF8A95FCF88747D94ULL,  -343,  -84 },
+    { 0xB94470938FA89BCFULL,  -316,  -76 }, { 0x8A08F0F8BF0F156BULL,  -289,  -68 },
+    { 0xCDB02555653131B6ULL,  -263,  -60 }, { 0x993FE2C6D07B7FACULL,  -236,  -52 },
+    { 0xE45C10C42A2B3B06ULL,  -210,  -44 }, { 0xAA242499697392D3ULL,  -183,  -36 },
+    { 0xFD87B5F28300CA0EULL,  -157,  -28 }, { 0xBCE5086492111AEBULL,  -130,  -20 },
+    { 0x8CBCCC096F5088CCULL,  -103,  -12 }, { 0xD1B71758E219652CULL,   -77,   -4 },
+    { 0x9C40000000000000ULL,   -50,    4 }, { 0xE8D4A51000000000ULL,   -24,   12 },
+    { 0xAD78EBC5AC620000ULL,     3,   20 }, { 0x813F3978F8940984ULL,    30,   28 },
+    { 0xC097CE7BC90715B3ULL,    56,   36 }, { 0x8F7E32CE7BEA5C70ULL,    83,   44 },
+    { 0xD5D238A4ABE98068ULL,   109,   52 }, { 0x9F4F2726179A2245ULL,   136,   60 },
+    { 0xED63A231D4C4FB27ULL,   162,   68 }, { 0xB0DE65388CC8ADA8ULL,   189,   76 },
+    { 0x83C7088E1AAB65DBULL,   216,   84 }, { 0xC45D1DF942711D9AULL,   242,   92 },
+    { 0x924D692CA61BE758ULL,   269,  100 }, { 0xDA01EE641A708DEAULL,   295,  108 },
+    { 0xA26DA3999AEF774AULL,   322,  116 }, { 0xF209787BB47D6B85ULL,   348,  124 },
+    { 0xB454E4A179DD1877ULL,   375,  132 }, { 0x865B86925B9BC5C2ULL,   402,  140 },
+    { 0xC83553C5C8965D3DULL,   428,  148 }, { 0x952AB45CFA97A0B3ULL,   455,  156 },
+    { 0xDE469FBD99A05FE3ULL,   481,  164 }, { 0xA59BC234DB398C25ULL,   508,  172 },
+    { 0xF6C69A72A3989F5CULL,   534,  180 }, { 0xB7DCBF5354E9BECEULL,   561,  188 },
+    { 0x88FCF317F22241E2ULL,   588,  196 }, { 0xCC20CE9BD35C78A5ULL,   614,  204 },
+    { 0x98165AF37B2153DFULL,   641,  212 }, { 0xE2A0B5DC971F303AULL,   667,  220 },
+    { 0xA8D9D1535CE3B396ULL,   694,  228 }, { 0xFB9B7CD9A4A7443CULL,   720,  236 },
+    { 0xBB764C4CA7A44410ULL,   747,  244 }, { 0x8BAB8EEFB6409C1AULL,   774,  252 },
+    { 0xD01FEF10A657842CULL,   800,  260 }, { 0x9B10A4E5E9913129ULL,   827,  268 },
+    { 0xE7109BFBA19C0C9DULL,   853,  276 }, { 0xAC2820D9623BF429ULL,   880,  284 },
+    { 0x80444B5E7AA7CF85ULL,   907,  292 }, { 0xBF21E44003ACDD2DULL,   933,  300 },
+    { 0x8E679C2F5E44FF8FULL,   960,  308 }, { 0xD433179D9C8CB841ULL,   986,  316 },
+    { 0x9E19DB92B4E31BA9ULL,  1013,  324 }, { 0xEB96BF6EBADF77D9ULL,  1039,  332 },
+    { 0xAF87023B9BF0EE6BULL,  1066,  340 },
+};
+
+/**
+ * @brief A cached 10^-k such that multiplying a value with binary exponent
+ * `e` lands its exponent in [-60, -32].
+ */
+CachedPower cachedPowerFor( int e ) noexcept
 {
-    this->setType( JsonType::INT );
-    this->setString( std::to_string( initVal ) );
+    const int alpha = -60;
+    const int f     = alpha - e - 1;
+    const int k     = ( f * 78913 ) / ( 1 << 18 ) + ( f > 0 ); // ceil(f * log10(2))
+    const int index = ( 300 + k + 7 ) / 8;
+    return CACHED_POWERS[index];
 }
 
-Json::Json( long initVal )
+inline int largestPow10( uint32_t n, uint32_t& pow10 ) noexcept
 {
-    this->setType( JsonType::INT );
-    this->setString( std::to_string( initVal ) );
+    static const uint32_t POW10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+    int digits = 10;
+    while( digits > 1 && n < POW10[digits - 1] ) --digits;
+    pow10 = POW10[digits - 1];
+    return digits;
 }
 
-Json::Json( long long initVal )
+/// Moves the last digit towards w while staying inside (M-, M+)
+inline void grisuRound( char* buf, int len, uint64_t dist, uint64_t delta, uint64_t rest, uint64_t tenK ) noexcept
 {
-    this->setType( JsonType::INT );
-    this->setString( std::to_string( initVal ) );
+    while( rest < dist && delta - rest >= tenK &&
+           ( rest + tenK < dist || dist - rest > rest + tenK - dist ) )
+    {
+        --buf[len - 1];
+        rest += tenK;
+    }
 }
 
-Json::Json( double initVal )
+/**
+ * @brief Generates the digits of w (between mMinus and mPlus).
+ * `len` and `exp10` describe the result: value = buf * 10^exp10.
+ */
+void grisuDigits( char* buf, int& len, int& exp10, DiyFp mMinus, DiyFp w, DiyFp mPlus ) noexcept
 {
-    this->setType( JsonType::DOUBLE );
-    this->setString( std::to_string( initVal ) );
+    uint64_t delta = diySub( mPlus, mMinus ).f;
+    uint64_t dist  = diySub( mPlus, w ).f;
+
+    const DiyFp one{ uint64_t( 1 ) << -mPlus.e, mPlus.e };
+
+    uint32_t p1 = static_cast<uint32_t>( mPlus.f >> -one.e ); // integral part
+    uint64_t p2 = mPlus.f & ( one.f - 1 );                    // fractional part
+
+    uint32_t pow10 = 1;
+    int      n     = largestPow10( p1, pow10 );
+
+    while( n > 0 )
+    {
+        const uint32_t d = p1 / pow10;
+        p1 %= pow10;
+        buf[len++] = static_cast<char>( '0' + d );
+        --n;
+
+        const uint64_t rest = ( uint64_t( p1 ) << -one.e ) + p2;
+        if( rest <= delta ) {
+            exp10 += n;
+            grisuRound( buf, len, dist, delta, rest, uint64_t( pow10 ) << -one.e );
+            return;
+        }
+        pow10 /= 10;
+    }
+
+    int m = 0;
+    while( true )
+    {
+        p2 *= 10;
+        buf[len++] = static_cast<char>( '0' + ( p2 >> -one.e ) );
+        p2 &= one.f - 1;
+        ++m;
+
+        delta *= 10;
+        dist  *= 10;
+        if( p2 <= delta ) break;
+    }
+    exp10 -= m;
+    grisuRound( buf, len, dist, delta, p2, one.f );
 }
 
-Json::Json( float initVal )
+/**
+ * @brief Shortest digits of a finite, positive value: buf * 10^exp10.
+ */
+void grisu2( char* buf, int& len, int& exp10, const Boundaries& b ) noexcept
 {
-    this->setType( JsonType::DOUBLE );
-    this->setString( std::to_string( initVal ) );
+    const CachedPower cached = cachedPowerFor( b.plus.e );
+    const DiyFp       c{ cached.f, cached.e };
+
+    const DiyFp w      = diyMul( b.w, c );
+    const DiyFp wMinus = diyMul( b.minus, c );
+    const DiyFp wPlus  = diyMul( b.plus, c );
+
+    // Shrink the interval by one unit to absorb the multiplication error
+    len   = 0;
+    exp10 = -cached.k;
+    grisuDigits( buf, len, exp10, DiyFp{ wMinus.f + 1, wMinus.e }, w, DiyFp{ wPlus.f - 1, wPlus.e } );
 }
 
-// -----------------------------------------------------------------------------
-// Boolean Constructor
-// -----------------------------------------------------------------------------
-Json::Json( bool initVal ) noexcept
+/**
+ * @brief Lays out `len` digits with decimal exponent `exp10` like
+ * JavaScript does: plain notation for 1e-7 < |v| < 1e21, exponent
+ * otherwise. Integral values keep a ".0" so they read back as doubles.
+ * `buf` must have room for 32 chars.
+ * @return One past the last char written.
+ */
+char* layoutDigits( char* buf, int len, int exp10 ) noexcept
 {
-    this->setType( JsonType::BOOLEAN );
-    this->setString( initVal ? "true" : "false" );
+    const int point = len + exp10; // position of the decimal point
+
+    if( len <= point && point <= 21 ) {                 // 1234000.0
+        std::memset( buf + len, '0', point - len );
+        buf[point]     = '.';
+        buf[point + 1] = '0';
+        return buf + point + 2;
+    }
+    if( 0 < point && point <= 21 ) {                    // 12.34
+        std::memmove( buf + point + 1, buf + point, len - point );
+        buf[point] = '.';
+        return buf + len + 1;
+    }
+    if( -6 < point && point <= 0 ) {                    // 0.001234
+        std::memmove( buf + 2 - point, buf, len );
+        buf[0] = '0';
+        buf[1] = '.';
+        std::memset( buf + 2, '0', -point );
+        return buf + 2 - point + len;
+    }
+
+    // 1.234e+25 / 1e-7
+    if( len > 1 ) {
+        std::memmove( buf + 2, buf + 1, len - 1 );
+        buf[1] = '.';
+        buf += len + 1;
+    } else {
+        buf += 1;
+    }
+    *buf++ = 'e';
+    const int e = point - 1;
+    *buf++ = ( e < 0 ) ? '-' : '+';
+    return writeUnsigned( buf, static_cast<uint64_t>( e < 0 ? -e : e ) );
 }
 
-// -----------------------------------------------------------------------------
-// Copy & Move Constructors
-// -----------------------------------------------------------------------------
-Json::Json( const Json& other )
+/**
+ * @brief Writes the shortest text that reads back as `v` (32 chars max).
+ * NaN and infinities have no JSON form and are written as null.
+ */
+template <int MantissaBits, int ExponentBits>
+char* writeShortest( char* out, bool negative, uint64_t bits ) noexcept
 {
-    this->jType      = other.jType;
-    this->strValue   = other.strValue;
-    this->arr        = other.arr;
-    this->properties = other.properties;
-    this->mapIndex   = other.mapIndex;
+    const int      bias         = ( 1 << ( ExponentBits - 1 ) ) - 1;
+    const uint64_t exponentMask = ( ( uint64_t( 1 ) << ExponentBits ) - 1 ) << MantissaBits;
+    if( ( bits & exponentMask ) == exponentMask ) {
+        std::memcpy( out, "null", 4 );
+        return out + 4;
+    }
+    if( negative ) *out++ = '-';
+    if( bits == 0 ) {
+        std::memcpy( out, "0.0", 3 );
+        return out + 3;
+    }
+
+    int len = 0, exp10 = 0;
+    grisu2( out, len, exp10, computeBoundaries<MantissaBits, bias>( bits ) );
+    return layoutDigits( out, len, exp10 );
 }
 
-Json::Json( Json&& other ) noexcept
-    : strValue  ( std::move( other.strValue ) )
-    , jType     ( other.jType )
-    , properties( std::move( other.properties ) )
-    , arr       ( std::move( other.arr ) )
-    , mapIndex  ( std::move( other.mapIndex ) )
+char* writeDouble( char* out, double v ) noexcept
 {
-    other.jType = JsonType::NULL_TYPE;
+    uint64_t bits;
+    std::memcpy( &bits, &v, sizeof( bits ) );
+    return writeShortest<52, 11>( out, ( bits >> 63 ) != 0, bits & ~( uint64_t( 1 ) << 63 ) );
 }
 
-Json::~Json()
+char* writeFloat( char* out, float v ) noexcept
 {
-    // Destructor logic (resources are managed by std containers)
+    uint32_t bits;
+    std::memcpy( &bits, &v, sizeof( bits ) );
+    return writeShortest<23, 8>( out, ( bits >> 31 ) != 0, bits & ~( uint32_t( 1 ) << 31 ) );
 }
 
+} // namespace
+
 // =============================================================================
-// [Operators]
+// [String Escaping]
 // =============================================================================
+// String values and keys are stored decoded (plain UTF-8). Escapes are
+// resolved once when a node is built and re-created only on output. Both
+// directions copy clean runs in bulk: unescaping jumps between backslashes
+// with memchr, escaping scans 16 or 32 bytes per step for quotes,
+// backslashes and control bytes (and non-ASCII bytes in ASCII-only mode).
 
-Json& Json::operator=( const Json& other )
+namespace {
+
+uint32_t decodeHex4( const char* p ) noexcept
 {
-    if( this != &other ){
-        this->jType      = other.jType;
-        this->strValue   = other.strValue;
-        this->arr        = other.arr;
-        this->properties = other.properties;
-        this->mapIndex   = other.mapIndex;
+    uint32_t v = 0;
+    for( int i = 0; i < 4; ++i )
+    {
+        const char c = p[i];
+        v <<= 4;
+        if     ( c >= '0' && c <= '9' ) v |= c - '0';
+        else if( c >= 'a' && c <= 'f' ) v |= c - 'a' + 10;
+        else if( c >= 'A' && c <= 'F' ) v |= c - 'A' + 10;
     }
-    return ( *this );
+    return v;
 }
 
-Json& Json::operator=( Json&& other ) noexcept
+char* appendUtf8( char* out, uint32_t cp ) noexcept
 {
-    if( this != &other ){
-        this->strValue   = std::move( other.strValue );
-        this->jType      = other.jType;
-        this->properties = std::move( other.properties );
-        this->arr        = std::move( other.arr );
-        this->mapIndex   = std::move( other.mapIndex );
-
-        other.jType = JsonType::NULL_TYPE;
+    if( cp < 0x80 ) {
+        *out++ = static_cast<char>( cp );
+    } else if( cp < 0x800 ) {
+        *out++ = static_cast<char>( 0xC0 | ( cp >> 6 ) );
+        *out++ = static_cast<char>( 0x80 | ( cp & 0x3F ) );
+    } else if( cp < 0x10000 ) {
+        *out++ = static_cast<char>( 0xE0 | ( cp >> 12 ) );
+        *out++ = static_cast<char>( 0x80 | ( ( cp >> 6 ) & 0x3F ) );
+        *out++ = static_cast<char>( 0x80 | ( cp & 0x3F ) );
+    } else {
+        *out++ = static_cast<char>( 0xF0 | ( cp >> 18 ) );
+        *out++ = static_cast<char>( 0x80 | ( ( cp >> 12 ) & 0x3F ) );
+        *out++ = static_cast<char>( 0x80 | ( ( cp >> 6 ) & 0x3F ) );
+        *out++ = static_cast<char>( 0x80 | ( cp & 0x3F ) );
     }
-    return ( *this );
+    return out;
 }
 
-// -----------------------------------------------------------------------------
-// Assignment Operators
-// -----------------------------------------------------------------------------
-Json& Json::operator=( const int value )
+/**
+ * @brief Decodes the (already validated) escapes of [first, last) into `out`.
+ * The decoded text is never longer than its source, so `out` may equal
+ * `first` for in-place decoding. Lone surrogates become U+FFFD.
+ * @return One past the last byte written.
+ */
+char* unescapeTo( const char* first, const char* last, char* out ) noexcept
 {
-    std::stringstream ss;
-    ss << value;
-    this->setType( JsonType::INT ).setString( ss.str() );
-    return ( *this );
+    while( first < last )
+    {
+        // Copy the run up to the next backslash in one go
+        const char* bs = static_cast<const char*>( std::memchr( first, '\\', last - first ) );
+        if( bs == nullptr ) bs = last;
+        if( out != first ) std::memmove( out, first, bs - first );
+        out  += bs - first;
+        first = bs;
+        if( first == last ) break;
+
+        const char e = first[1];
+        first += 2;
+        switch( e ) {
+            case 'b': *out++ = '\b'; break;
+            case 'f': *out++ = '\f'; break;
+            case 'n': *out++ = '\n'; break;
+            case 'r': *out++ = '\r'; break;
+            case 't': *out++ = '\t'; break;
+            case 'u':
+            {
+                uint32_t cp = decodeHex4( first );
+                first += 4;
+                if( cp >= 0xD800 && cp <= 0xDBFF ) {
+                    const uint32_t lo = ( last - first >= 6 && first[0] == '\\' && first[1] == 'u' )
+                                      ? decodeHex4( first + 2 ) : 0;
+                    if( lo >= 0xDC00 && lo <= 0xDFFF ) {
+                        cp = 0x10000 + ( ( cp - 0xD800 ) << 10 ) + ( lo - 0xDC00 );
+                        first += 6;
+                    } else {
+                        cp = 0xFFFD;
+                    }
+                } else if( cp >= 0xDC00 && cp <= 0xDFFF ) {
+                    cp = 0xFFFD;
+                }
+                out = appendUtf8( out, cp );
+                break;
+            }
+            default: *out++ = e; break; // '"', '\\', '/'
+        }
+    }
+    return out;
 }
 
-Json& Json::operator=( const double value )
+/**
+ * @brief Returns the length of the prefix of [s, s + n) that can be copied
+ * to JSON output unchanged.
+ */
+std::size_t cleanRunScalar( const unsigned char* s, std::size_t n, bool asciiOnly ) noexcept
 {
-    std::stringstream ss;
-    ss << value;
-    this->setType( JsonType::DOUBLE ).setString( ss.str() );
-    return ( *this );
+    std::size_t i = 0;
+    for( ; i < n; ++i ) {
+        const unsigned char c = s[i];
+        if( c < 0x20 || c == '"' || c == '\\' || ( asciiOnly && c >= 0x80 ) ) break;
+    }
+    return i;
 }
 
-Json& Json::operator=( const std::string& value )
+#if TINYJSON_X86_64
+std::size_t cleanRunSse2( const unsigned char* s, std::size_t n, bool asciiOnly ) noexcept
 {
-    if( Parser::isObject( value ) )
-        *this = Parser::parse( value );
-    else
-        this->setType( JsonType::STRING ).setString( value );
-    return ( *this );
+    const __m128i quote = _mm_set1_epi8( '"' );
+    const __m128i bs    = _mm_set1_epi8( '\\' );
+    const __m128i ctrl  = _mm_set1_epi8( 0x1F );
+    const int     high  = asciiOnly ? 0xFFFF : 0;
+
+    std::size_t i = 0;
+    for( ; i + 16 <= n; i += 16 )
+    {
+        const __m128i v   = _mm_loadu_si128( reinterpret_cast<const __m128i*>( s + i ) );
+        const __m128i hit = _mm_or_si128(
+            _mm_or_si128( _mm_cmpeq_epi8( v, quote ), _mm_cmpeq_epi8( v, bs ) ),
+            _mm_cmpeq_epi8( _mm_max_epu8( v, ctrl ), ctrl ) ); // v <= 0x1F
+        const int mask = _mm_movemask_epi8( hit ) | ( _mm_movemask_epi8( v ) & high );
+        if( mask != 0 )
+            return i + __builtin_ctz( static_cast<unsigned>( mask ) );
+    }
+    return i + cleanRunScalar( s + i, n - i, asciiOnly );
 }
+#endif
 
-Json& Json::operator=( const char* value )
+#if TINYJSON_HAS_AVX2
+__attribute__(( target( "avx2" ) ))
+std::size_t cleanRunAvx2( const unsigned char* s, std::size_t n, bool asciiOnly ) noexcept
 {
-    return this->operator=( std::string( value ) );
+    const __m256i  quote = _mm256_set1_epi8( '"' );
+    const __m256i  bs    = _mm256_set1_epi8( '\\' );
+    const __m256i  ctrl  = _mm256_set1_epi8( 0x1F );
+    const uint32_t high  = asciiOnly ? 0xFFFFFFFFu : 0;
+
+    std::size_t i = 0;
+    for( ; i + 32 <= n; i += 32 )
+    {
+        const __m256i v   = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( s + i ) );
+        const __m256i hit = _mm256_or_si256(
+            _mm256_or_si256( _mm256_cmpeq_epi8( v, quote ), _mm256_cmpeq_epi8( v, bs ) ),
+            _mm256_cmpeq_epi8( _mm256_max_epu8( v, ctrl ), ctrl ) );
+        const uint32_t mask = uint32_t( _mm256_movemask_epi8( hit ) )
+                            | ( uint32_t( _mm256_movemask_epi8( v ) ) & high );
+        if( mask != 0 )
+            return i + __builtin_ctz( mask );
+    }
+    return i + cleanRunScalar( s + i, n - i, asciiOnly );
 }
+#endif
 
-Json& Json::operator=( const bool value )
+using CleanRunFn = std::size_t (*)( const unsigned char*, std::size_t, bool );
+
+CleanRunFn selectCleanRun() noexcept
 {
-    this->setType( JsonType::BOOLEAN ).setString( value ? "true" : "false" );
-    return ( *this );
+#if TINYJSON_HAS_AVX2
+    __builtin_cpu_init();
+    if( __builtin_cpu_supports( "avx2" ) )
+        return cleanRunAvx2;
+#endif
+#if TINYJSON_X86_64
+    return cleanRunSse2;
+#else
+    return cleanRunScalar;
+#endif
 }
 
-// -----------------------------------------------------------------------------
-// Access Operators
-// -----------------------------------------------------------------------------
-Json& Json::operator[]( const int i )
-{
-    if( this->jType != JsonType::ARRAY )
-        throw TinyJsonException( "Invalid access: Operator[] int used on non-array type" );
+const CleanRunFn cleanRun = selectCleanRun();
 
-    if( i < 0 || i >= (int)this->arr.size() )
-        throw TinyJsonException( "Index out of range" );
+const char HEX_DIGITS[] = "0123456789abcdef";
 
-    return this->arr[i];
+void appendUnicodeEscape( std::string& out, uint32_t unit )
+{
+    const char esc[6] = { '\\', 'u', HEX_DIGITS[( unit >> 12 ) & 0xF], HEX_DIGITS[( unit >> 8 ) & 0xF],
+                          HEX_DIGITS[( unit >> 4 ) & 0xF], HEX_DIGITS[unit & 0xF] };
+    out.append( esc, 6 );
 }
 
-Json& Json::operator[]( const std::string& key )
+/**
+ * @brief Decodes one UTF-8 sequence at s (s < end, *s >= 0x80).
+ * Malformed, overlong or surrogate sequences decode as U+FFFD over one byte.
+ */
+uint32_t decodeUtf8( const unsigned char*& s, const unsigned char* end ) noexcept
 {
-    if( this->jType != JsonType::OBJECT && this->jType != JsonType::UNKNOWN ){
-        throw TinyJsonException( "Invalid access: Operator[] string used on non-object type" );
+    const unsigned char c = *s;
+    int      len = 0;
+    uint32_t cp  = 0, min = 0;
+    if     ( c >= 0xC2 && c <= 0xDF ) { len = 2; cp = c & 0x1F; min = 0x80;    }
+    else if( c >= 0xE0 && c <= 0xEF ) { len = 3; cp = c & 0x0F; min = 0x800;   }
+    else if( c >= 0xF0 && c <= 0xF4 ) { len = 4; cp = c & 0x07; min = 0x10000; }
+
+    if( len == 0 || end - s < len ) { ++s; return 0xFFFD; }
+    for( int k = 1; k < len; ++k ) {
+        if( ( s[k] & 0xC0 ) != 0x80 ) { ++s; return 0xFFFD; }
+        cp = ( cp << 6 ) | ( s[k] & 0x3F );
     }
+    if( cp < min || cp > 0x10FFFF || ( cp >= 0xD800 && cp <= 0xDFFF ) ) { ++s; return 0xFFFD; }
+    s += len;
+    return cp;
+}
 
-    // Initialize as Object if UNKNOWN
-    if( this->jType == JsonType::UNKNOWN ) {
-        this->setType( JsonType::OBJECT );
+/**
+ * @brief Appends [s, s + n) to `out` as the body of a JSON string literal.
+ * Only '"', '\\' and control bytes are escaped; with `asciiOnly` every
+ * non-ASCII character becomes \\uXXXX (a surrogate pair above U+FFFF).
+ */
+void appendEscaped( std::string& out, const char* str, std::size_t n, bool asciiOnly )
+{
+    const unsigned char*       s   = reinterpret_cast<const unsigned char*>( str );
+    const unsigned char* const end = s + n;
+
+    while( true )
+    {
+        const std::size_t clean = cleanRun( s, end - s, asciiOnly );
+        out.append( reinterpret_cast<const char*>( s ), clean );
+        s += clean;
+        if( s == end ) return;
+
+        const unsigned char c = *s;
+        if( c >= 0x80 ) {
+            const uint32_t cp = decodeUtf8( s, end );
+            if( cp >= 0x10000 ) {
+                appendUnicodeEscape( out, 0xD800 + ( ( cp - 0x10000 ) >> 10 ) );
+                appendUnicodeEscape( out, 0xDC00 + ( ( cp - 0x10000 ) & 0x3FF ) );
+            } else {
+                appendUnicodeEscape( out, cp );
+            }
+            continue;
+        }
+
+        ++s;
+        switch( c ) {
+            case '"':  out.append( "\\\"", 2 ); break;
+            case '\\': out.append( "\\\\", 2 ); break;
+            case '\b': out.append( "\\b", 2 );  break;
+            case '\f': out.append( "\\f", 2 );  break;
+            case '\n': out.append( "\\n", 2 );  break;
+            case '\r': out.append( "\\r", 2 );  break;
+            case '\t': out.append( "\\t", 2 );  break;
+            default:   appendUnicodeEscape( out, c ); break;
+        }
     }
+}
 
-    if( this->mapIndex.find( key ) == this->mapIndex.end() ) {
-        this->addObject( key, JsonNULL() );
+/**
+ * @brief Stores the text of a string token in `dst`, decoding its escapes.
+ */
+void assignUnescaped( std::string& dst, const char* s, std::size_t n, bool escaped )
+{
+    if( !escaped ) {
+        dst.assign( s, n );
+        return;
     }
-    return this->properties[this->mapIndex[key]].second;
+    dst.resize( n );
+    dst.resize( unescapeTo( s, s + n, &dst[0] ) - &dst[0] );
 }
 
-const Json& Json::operator[]( const int i ) const
+} // namespace
+
+// =============================================================================
+// [String Interning]
+// =============================================================================
+// Keys (and, on request, short string values) are SharedStrings. Each parse
+// interns them in a KeyCache, so the records of a same-shaped array share
+// one buffer per key; a caller's StringPool extends that across documents.
+
+SharedString::Rep* SharedString::allocate( std::size_t size )
 {
-    if( this->jType != JsonType::ARRAY )
-        throw TinyJsonException( "Invalid access: Operator[] int used on non-array type" );
+    if( size >= UINT32_MAX )
+        throw TinyJsonException( "String larger than 4 GiB is not supported" );
 
-    if( i < 0 || i >= (int)this->arr.size() )
-        throw TinyJsonException( "Index out of range" );
+    void* raw = ::operator new( offsetof( Rep, text ) + size + 1 );
+    Rep*  r   = static_cast<Rep*>( raw );
+    new( &r->refs ) std::atomic<uint32_t>( 1 );
+    r->size       = static_cast<uint32_t>( size );
+    r->text[size] = '\0';
+    return r;
+}
 
-    return this->arr[i];
+SharedString::SharedString( StringView text )
+    : rep( nullptr )
+{
+    if( text.empty() ) return;
+    this->rep = allocate( text.size() );
+    std::memcpy( this->rep->text, text.data(), text.size() );
 }
 
-const Json& Json::operator[]( const std::string& key ) const
+SharedString SharedString::decode( const char* s, std::size_t n, bool escaped )
 {
-    if( this->jType != JsonType::OBJECT )
-        throw TinyJsonException( "Invalid access: Operator[] string used on non-object type" );
+    if( !escaped ) return SharedString( StringView( s, n ) );
+
+    // Decoding only shrinks the text; the spare bytes stay unused
+    Rep* r = allocate( n );
+    r->size = static_cast<uint32_t>( unescapeTo( s, s + n, r->text ) - r->text );
+    r->text[r->size] = '\0';
+    return SharedString( r );
+}
+
+namespace {
+
+/**
+ * @brief Hashes a key eight bytes at a time.
+ */
+inline std::size_t hashBytes( const char* s, std::size_t n ) noexcept
+{
+    uint64_t h = 0x9E3779B97F4A7C15ULL ^ n;
+    for( ; n >= 8; s += 8, n -= 8 ) {
+        uint64_t w;
+        std::memcpy( &w, s, 8 );
+        h = ( h ^ w ) * 0xFF51AFD7ED558CCDULL;
+        h ^= h >> 32;
+    }
+    if( n > 0 ) {
+        uint64_t w = 0;
+        std::memcpy( &w, s, n );
+        h = ( h ^ w ) * 0xC4CEB9FE1A85EC53ULL;
+    }
+    h ^= h >> 29;
+    return static_cast<std::size_t>( h );
+}
+
+struct KeyHash
+{
+    std::size_t operator()( StringView s ) const noexcept { return hashBytes( s.data(), s.size() ); }
+};
+
+// Text -> its shared copy; the keys view the values' own buffers
+using StringSet = std::unordered_map<StringView, SharedString, KeyHash>;
+
+SharedString internIn( StringSet& set, StringView text )
+{
+    auto it = set.find( text );
+    if( it != set.end() )
+        return it->second;
+
+    SharedString s( text );
+    set.emplace( s.view(), s );
+    return s;
+}
+
+} // namespace
+
+struct StringPool::Impl
+{
+    mutable std::mutex mutex;
+    StringSet          strings;
+};
+
+StringPool::StringPool()
+    : impl( new Impl() )
+{
+}
+
+StringPool::~StringPool() = default;
+
+SharedString StringPool::intern( StringView text )
+{
+    std::lock_guard<std::mutex> lock( this->impl->mutex );
+    return internIn( this->impl->strings, text );
+}
+
+std::size_t StringPool::size() const
+{
+    std::lock_guard<std::mutex> lock( this->impl->mutex );
+    return this->impl->strings.size();
+}
+
+void StringPool::clear()
+{
+    std::lock_guard<std::mutex> lock( this->impl->mutex );
+    this->impl->strings.clear();
+}
+
+/**
+ * @brief Interns the keys (and short string values, if asked) of one parse.
+ * Misses go to the caller's StringPool when there is one, so the pool's
+ * lock is taken once per distinct key rather than once per key. The cache
+ * is emptied when it grows large: a stream of ever-new keys gains nothing
+ * from it and must not grow it without bound.
+ */
+class Parser::KeyCache
+{
+public:
+    explicit KeyCache( const ParseOptions& options = ParseOptions() )
+        : pool( options.pool ), valueLength( options.internValueLength )
+    {}
+
+    SharedString key( StringView text )
+    {
+        auto it = this->cache.find( text );
+        if( it != this->cache.end() )
+            return it->second;
+
+        if( this->cache.size() >= MAX_ENTRIES )
+            this->cache.clear();
+
+        SharedString s = this->pool ? this->pool->intern( text ) : SharedString( text );
+        this->cache.emplace( s.view(), s );
+        return s;
+    }
+
+    /** @brief Decoded string value; interned if short enough. */
+    SharedString value( const char* s, std::size_t n, bool escaped )
+    {
+        if( n > this->valueLength )
+            return SharedString::decode( s, n, escaped );
+        if( !escaped )
+            return this->key( StringView( s, n ) );
+
+        assignUnescaped( this->scratch, s, n, true );
+        return this->key( this->scratch );
+    }
+
+private:
+    static const std::size_t MAX_ENTRIES = 4096;
+
+    StringSet   cache;
+    StringPool* pool;
+    std::size_t valueLength;
+    std::string scratch;
+};
+
+// =============================================================================
+// [Global Helper Functions]
+// =============================================================================
+
+Json JsonObject()
+{
+    return Json( JsonType::OBJECT );
+}
+
+Json JsonObject( std::initializer_list<std::pair<std::string, Json>> members )
+{
+    Json obj = JsonObject();
+    obj.reserve( members.size() );
+    for( const auto& m : members ) obj.addObject( m.first, m.second );
+    return obj;
+}
+
+Json JsonArray()
+{
+    return Json( JsonType::ARRAY );
+}
+
+Json JsonArray( std::initializer_list<Json> elements )
+{
+    Json arr = JsonArray();
+    arr.reserve( elements.size() );
+    for( const auto& e : elements ) arr.emplaceBack( e );
+    return arr;
+}
+
+Json JsonNULL()
+{
+    return Json( JsonType::NULL_TYPE );
+}
+
+// =============================================================================
+// [Json Node Storage]
+// =============================================================================
+
+/**
+ * @brief Members of an OBJECT or ARRAY node, owned through Json::val.box.
+ * A lazy container keeps them empty until load() builds them.
+ *
+ * Most objects have a handful of members, which a linear scan finds
+ * fastest. Past LINEAR_LOOKUP_MAX members an open-addressing table of
+ * member indices takes over; it is built when the object first grows past
+ * that size (every insertion looks its key up first) and holds no key
+ * text. Lookups never modify the table, so const reads stay thread-safe.
+ */
+struct Json::Container
+{
+    static const std::size_t LINEAR_LOOKUP_MAX = 8;
+    static const std::size_t NOT_FOUND         = static_cast<std::size_t>( -1 );
+
+    struct Slot {
+        uint32_t member; // index in `properties` + 1; 0 marks an empty slot
+        uint32_t hash;
+    };
+
+    JsonObjects             properties;
+    JsonArrays              arr;
+    std::unique_ptr<Slot[]> index;         // null up to LINEAR_LOOKUP_MAX members
+    std::size_t             indexMask = 0; // slot count - 1 (a power of two)
+
+    // Lazy nodes: text and container extents shared by the whole document,
+    // and the index of this container's extent. Null once built.
+    std::shared_ptr<const LazySource> lazySrc;
+    uint32_t                          lazyNode = 0;
+
+    // Json values sharing this container (copy-on-write)
+    std::atomic<uint32_t> refs{ 1 };
+
+    // A reference or iterator into this container was handed out (by a
+    // const accessor too: the owner's later writes must not move it away),
+    // so copies of the owner copy the container instead of sharing it
+    // (see leak). Never cleared; const readers on several threads may set
+    // it at the same time.
+    std::atomic<bool> leaked{ false };
+
+    void markLeaked() noexcept
+    {
+        if( !this->leaked.load( std::memory_order_relaxed ) ) // keep the line clean for readers
+            this->leaked.store( true, std::memory_order_relaxed );
+    }
+
+    Container() = default;
+
+    // A private copy for an owner about to modify a shared container; the
+    // members themselves are shared again, one level down
+    Container( const Container& other )
+        : properties( other.properties ), arr( other.arr ), indexMask( other.indexMask )
+        , lazySrc( other.lazySrc ), lazyNode( other.lazyNode )
+    {
+        if( other.index ) {
+            this->index.reset( new Slot[this->indexMask + 1] );
+            std::memcpy( this->index.get(), other.index.get(), ( this->indexMask + 1 ) * sizeof( Slot ) );
+        }
+    }
+
+    static uint32_t hashOf( StringView key ) noexcept
+    {
+        return static_cast<uint32_t>( hashBytes( key.data(), key.size() ) );
+    }
+
+    /** @brief Position of `key` in `properties`, or NOT_FOUND. */
+    std::size_t find( StringView key ) const noexcept
+    {
+        return this->find( key, this->index ? hashOf( key ) : 0 );
+    }
+
+    /** @brief find() with hashOf( key ) computed beforehand (see JsonPath). */
+    std::size_t find( StringView key, uint32_t h ) const noexcept
+    {
+        if( !this->index ) {
+            for( std::size_t i = 0; i < this->properties.size(); ++i ) {
+                if( this->properties[i].first.view() == key ) return i;
+            }
+            return NOT_FOUND;
+        }
+
+        for( std::size_t i = h & this->indexMask; ; i = ( i + 1 ) & this->indexMask )
+        {
+            const Slot& slot = this->index[i];
+            if( slot.member == 0 ) return NOT_FOUND;
+            if( slot.hash == h && this->properties[slot.member - 1].first.view() == key )
+                return slot.member - 1;
+        }
+    }
+
+    /** @brief Appends a member whose key is known to be absent. */
+    Json& append( SharedString key, const Json& value )
+    {
+        this->properties.emplace_back( std::move( key ), value );
+        this->indexLast();
+        return this->properties.back().second;
+    }
+
+    Json& append( SharedString key, Json&& value )
+    {
+        this->properties.emplace_back( std::move( key ), std::move( value ) );
+        this->indexLast();
+        return this->properties.back().second;
+    }
+
+private:
+    // Keeps the table current after a member was appended (load <= 1/2)
+    void indexLast()
+    {
+        const std::size_t count = this->properties.size();
+        if( count <= LINEAR_LOOKUP_MAX ) return;
+
+        if( !this->index ) {
+            this->buildIndex(); // covers the new member too
+            return;
+        }
+        if( count * 2 > this->indexMask + 1 )
+            this->growIndex();
+        this->insertSlot( static_cast<uint32_t>( count ), hashOf( this->properties.back().first.view() ) );
+    }
+
+    void buildIndex()
+    {
+        std::size_t slots = 16;
+        while( slots < this->properties.size() * 4 ) slots *= 2;
+
+        this->index.reset( new Slot[slots]() );
+        this->indexMask = slots - 1;
+        for( std::size_t i = 0; i < this->properties.size(); ++i )
+            this->insertSlot( static_cast<uint32_t>( i + 1 ), hashOf( this->properties[i].first.view() ) );
+    }
+
+    // Doubles the table; hashes are kept in the slots, so no key is rehashed
+    void growIndex()
+    {
+        const std::unique_ptr<Slot[]> old( std::move( this->index ) );
+        const std::size_t             oldSlots = this->indexMask + 1;
+
+        this->index.reset( new Slot[oldSlots * 2]() );
+        this->indexMask = oldSlots * 2 - 1;
+        for( std::size_t i = 0; i < oldSlots; ++i ) {
+            if( old[i].member != 0 ) this->insertSlot( old[i].member, old[i].hash );
+        }
+    }
+
+    void insertSlot( uint32_t member, uint32_t hash ) noexcept
+    {
+        std::size_t i = hash & this->indexMask;
+        while( this->index[i].member != 0 ) i = ( i + 1 ) & this->indexMask;
+        this->index[i] = Slot{ member, hash };
+    }
+};
+
+inline void Json::load() const
+{
+    if( ( this->jType == JsonType::OBJECT || this->jType == JsonType::ARRAY ) && this->val.box->lazySrc )
+        this->materialize();
+}
+
+/**
+ * @brief Returns this container for modification, first copying it if
+ * other values share it. Only the path being modified is copied: the
+ * copy's members still share their own containers.
+ */
+inline Json::Container& Json::unshare()
+{
+    Container* c = this->val.box;
+    if( c->refs.load( std::memory_order_acquire ) != 1 )
+    {
+        Container* copy = new Container( *c );
+        if( c->refs.fetch_sub( 1, std::memory_order_acq_rel ) == 1 )
+            delete c; // the other owners let go meanwhile
+        this->val.box = copy;
+    }
+    return *this->val.box;
+}
+
+/**
+ * @brief unshare() for accessors that hand out a reference or iterator
+ * into the container. The container is marked so that it is never shared
+ * again: a later copy of this value gets its own container, so writes
+ * through the reference cannot reach the copy, and writes to this value
+ * do not move the referenced members to a new container.
+ */
+inline Json::Container& Json::leak()
+{
+    Container& c = this->unshare();
+    c.markLeaked();
+    return c;
+}
+
+/**
+ * @brief leak() for const accessors: the container is marked, not copied.
+ * A container that is already shared stays shared; the mark only applies
+ * to copies taken from here on.
+ */
+inline const Json::Container& Json::leak() const
+{
+    this->val.box->markLeaked();
+    return *this->val.box;
+}
+
+Json& Json::leak( Json& child )
+{
+    this->val.box->markLeaked(); // `child` lives in it, already unshared
+    return child;
+}
+
+namespace {
+
+// Iterators over scalars start and end here
+JsonArrays&  emptyElements()   { static JsonArrays  none; return none; }
+JsonObjects& emptyProperties() { static JsonObjects none; return none; }
+
+} // namespace
+
+// =============================================================================
+// [Json Constructors & Destructor]
+// =============================================================================
+
+Json::Json() noexcept
+    : jType( JsonType::UNKNOWN )
+{
+    this->val.u = 0;
+}
+
+Json::Json( const JsonType type )
+    : jType( JsonType::UNKNOWN )
+{
+    this->val.u = 0;
+    this->reset( type );
+}
+
+// -----------------------------------------------------------------------------
+// String Constructors
+// -----------------------------------------------------------------------------
+Json::Json( const char* initVal )
+    : Json()
+{
+    this->adoptString( SharedString( StringView( initVal ) ) );
+}
+
+Json::Json( const std::string& initVal )
+    : Json()
+{
+    this->adoptString( SharedString( StringView( initVal ) ) );
+}
+
+Json::Json( char initVal )
+    : Json()
+{
+    this->adoptString( SharedString( StringView( &initVal, 1 ) ) );
+}
+
+// -----------------------------------------------------------------------------
+// Numeric Constructors
+// -----------------------------------------------------------------------------
+Json::Json( int initVal )
+    : Json()
+{
+    this->setInteger( initVal );
+}
+
+Json::Json( long initVal )
+    : Json()
+{
+    this->setInteger( initVal );
+}
+
+Json::Json( long long initVal )
+    : Json()
+{
+    this->setInteger( initVal );
+}
+
+Json::Json( unsigned int initVal )
+    : Json()
+{
+    this->setUnsigned( initVal );
+}
+
+Json::Json( unsigned long initVal )
+    : Json()
+{
+    this->setUnsigned( initVal );
+}
+
+Json::Json( unsigned long long initVal )
+    : Json()
+{
+    this->setUnsigned( initVal );
+}
+
+Json::Json( double initVal )
+    : Json()
+{
+    this->setDouble( initVal );
+}
+
+Json::Json( float initVal )
+    : Json()
+{
+    // Store the double closest to the float's shortest text (0.1f -> 0.1)
+    char buf[32];
+    const char* end = writeFloat( buf, initVal );
+    this->setDouble( std::isfinite( initVal ) ? parseDouble( buf, end - buf ) : initVal );
+}
+
+// -----------------------------------------------------------------------------
+// Boolean Constructor
+// -----------------------------------------------------------------------------
+Json::Json( bool initVal ) noexcept
+    : Json()
+{
+    this->setBoolean( initVal );
+}
+
+// -----------------------------------------------------------------------------
+// Copy & Move Constructors
+// -----------------------------------------------------------------------------
+Json::Json( const Json& other )
+    : jType  ( other.jType )
+    , numKind( other.numKind )
+{
+    // Containers and strings are shared; a container is copied when one of
+    // its owners first modifies it (see unshare), or right away if
+    // references into it may still be written through (see leak)
+    this->val = other.val;
+    if( this->jType == JsonType::OBJECT || this->jType == JsonType::ARRAY ) {
+        if( other.val.box->leaked.load( std::memory_order_relaxed ) )
+            this->val.box = new Container( *other.val.box );
+        else
+            this->val.box->refs.fetch_add( 1, std::memory_order_relaxed );
+    }
+    else if( this->ownsString() )
+        SharedString::retain( this->val.str );
+}
+
+Json::Json( Json&& other ) noexcept
+    : val    ( other.val )
+    , jType  ( other.jType )
+    , numKind( other.numKind )
+{
+    other.val.u   = 0;
+    other.jType   = JsonType::NULL_TYPE;
+    other.numKind = NumberKind::Int64;
+}
+
+Json::~Json()
+{
+    this->reset( JsonType::UNKNOWN );
+}
+
+// =============================================================================
+// [Operators]
+// =============================================================================
+
+Json& Json::operator=( const Json& other )
+{
+    if( this != &other ){
+        Json copy( other );
+        *this = std::move( copy );
+    }
+    return ( *this );
+}
+
+Json& Json::operator=( Json&& other ) noexcept
+{
+    if( this != &other ){
+        // Detach first: `other` may live inside the value being replaced
+        Json taken( std::move( other ) );
+        this->reset( JsonType::UNKNOWN );
+
+        this->val     = taken.val;
+        this->jType   = taken.jType;
+        this->numKind = taken.numKind;
+        taken.val.u   = 0;
+        taken.jType   = JsonType::UNKNOWN;
+    }
+    return ( *this );
+}
+
+// -----------------------------------------------------------------------------
+// Assignment Operators
+// -----------------------------------------------------------------------------
+Json& Json::operator=( const int value )
+{
+    this->setInteger( value );
+    return ( *this );
+}
+
+Json& Json::operator=( const long value )
+{
+    this->setInteger( value );
+    return ( *this );
+}
+
+Json& Json::operator=( const long long value )
+{
+    this->setInteger( value );
+    return ( *this );
+}
+
+Json& Json::operator=( const unsigned int value )
+{
+    this->setUnsigned( value );
+    return ( *this );
+}
+
+Json& Json::operator=( const unsigned long value )
+{
+    this->setUnsigned( value );
+    return ( *this );
+}
+
+Json& Json::operator=( const unsigned long long value )
+{
+    this->setUnsigned( value );
+    return ( *this );
+}
+
+Json& Json::operator=( const double value )
+{
+    this->setDouble( value );
+    return ( *this );
+}
+
+Json& Json::operator=( const std::string& value )
+{
+    return this->assignText( value );
+}
+
+Json& Json::operator=( const char* value )
+{
+    return this->assignText( value );
+}
+
+Json& Json::assignText( StringView text )
+{
+    // JSON text becomes the value it describes, anything else a string.
+    // Text that cannot start a JSON value skips the parser entirely.
+    const char* p = text.data();
+    const char* const end = p + text.size();
+    while( p < end && ( *p == ' ' || *p == '\t' || *p == '\n' || *p == '\r' ) ) ++p;
+    if( p < end && *p != '\0' && std::strchr( "{[\"-0123456789tfn", *p ) != nullptr )
+    {
+        Json parsed( JsonType::UNKNOWN );
+        if( Parser::tryParse( text, parsed ) )
+            return ( *this = std::move( parsed ) );
+    }
+    return this->assignString( text );
+}
+
+Json& Json::assignJson( StringView text )
+{
+    return ( *this = Parser::parse( text, ParseOptions() ) );
+}
+
+Json& Json::assignString( StringView value )
+{
+    this->adoptString( SharedString( value ) );
+    return ( *this );
+}
+
+Json& Json::operator=( const bool value )
+{
+    this->setBoolean( value );
+    return ( *this );
+}
+
+// -----------------------------------------------------------------------------
+// Access Operators
+// -----------------------------------------------------------------------------
+Json& Json::operator[]( const int i )
+{
+    if( this->jType != JsonType::ARRAY )
+        throw TinyJsonException( "Invalid access: Operator[] int used on non-array type" );
+
+    this->load();
+    JsonArrays& arr = this->leak().arr;
+    if( i < 0 || i >= (int)arr.size() )
+        throw TinyJsonException( "Index out of range" );
+
+    return arr[i];
+}
+
+Json& Json::operator[]( StringView key )
+{
+    if( this->jType != JsonType::OBJECT && this->jType != JsonType::UNKNOWN ){
+        throw TinyJsonException( "Invalid access: Operator[] string used on non-object type" );
+    }
+
+    // Initialize as Object if UNKNOWN
+    if( this->jType == JsonType::UNKNOWN ) {
+        this->setType( JsonType::OBJECT );
+    }
+
+    this->load();
+    Container&        c     = this->leak();
+    const std::size_t found = c.find( key );
+    if( found == Container::NOT_FOUND )
+        return c.append( SharedString( key ), Json( JsonType::NULL_TYPE ) );
+    return c.properties[found].second;
+}
+
+const Json& Json::operator[]( const int i ) const
+{
+    if( this->jType != JsonType::ARRAY )
+        throw TinyJsonException( "Invalid access: Operator[] int used on non-array type" );
+
+    this->load();
+    const JsonArrays& arr = this->leak().arr;
+    if( i < 0 || i >= (int)arr.size() )
+        throw TinyJsonException( "Index out of range" );
+
+    return arr[i];
+}
+
+const Json& Json::operator[]( StringView key ) const
+{
+    if( this->jType != JsonType::OBJECT )
+        throw TinyJsonException( "Invalid access: Operator[] string used on non-object type" );
+
+    this->load();
+    const Container&  c     = this->leak();
+    const std::size_t found = c.find( key );
+    if( found == Container::NOT_FOUND )
+        throw TinyJsonException( "Key not found: " + key.toString() );
+
+    return c.properties[found].second;
+}
+
+// =============================================================================
+// [Value Accessors (Template Specializations)]
+// =============================================================================
+
+template <typename T>
+T Json::getAs() const
+{
+    T ret;
+    std::stringstream ss( this->getAs<std::string>() );
+    ss >> ret;
+    return ret;
+}
+
+template <>
+bool Json::getAs<bool>() const
+{
+    if( this->isBool() ) return this->val.b;
+    return this->isString() && this->text() == StringView( "true", 4 );
+}
+
+template <>
+std::string Json::getAs<std::string>() const
+{
+    switch( this->jType ) {
+        case JsonType::INT:
+        case JsonType::DOUBLE:    return this->numberText();
+        case JsonType::STRING:    return this->text().toString();
+        case JsonType::BOOLEAN:   return this->val.b ? "true" : "false";
+        case JsonType::NULL_TYPE: return "null";
+        default:                  return std::string(); // containers have no text
+    }
+}
+
+template <>
+int Json::getAs<int>() const
+{
+    if( this->isInt() || this->isDouble() )
+        return this->integerValue<int>();
+
+    try {
+        return std::stoi( this->getAs<std::string>() );
+    }
+    catch ( ... ) { return 0; }
+}
+
+template <>
+long Json::getAs<long>() const
+{
+    if( this->isInt() || this->isDouble() )
+        return this->integerValue<long>();
+
+    try {
+        return std::stol( this->getAs<std::string>() );
+    }
+    catch ( ... ) { return 0; }
+}
+
+template <>
+long long Json::getAs<long long>() const
+{
+    if( this->isInt() || this->isDouble() )
+        return this->integerValue<long long>();
+
+    try {
+        return std::stoll( this->getAs<std::string>() );
+    }
+    catch ( ... ) { return 0; }
+}
+
+template <>
+unsigned int Json::getAs<unsigned int>() const
+{
+    if( this->isInt() || this->isDouble() )
+        return this->integerValue<unsigned int>();
+
+    try {
+        return static_cast<unsigned int>( std::stoul( this->getAs<std::string>() ) );
+    }
+    catch ( ... ) { return 0; }
+}
+
+template <>
+unsigned long Json::getAs<unsigned long>() const
+{
+    if( this->isInt() || this->isDouble() )
+        return this->integerValue<unsigned long>();
+
+    try {
+        return std::stoul( this->getAs<std::string>() );
+    }
+    catch ( ... ) { return 0; }
+}
+
+template <>
+unsigned long long Json::getAs<unsigned long long>() const
+{
+    if( this->isInt() || this->isDouble() )
+        return this->integerValue<unsigned long long>();
+
+    try {
+        return std::stoull( this->getAs<std::string>() );
+    }
+    catch ( ... ) { return 0; }
+}
+
+template <>
+double Json::getAs<double>() const
+{
+    if( this->isInt() || this->isDouble() )
+    {
+        switch( this->numKind ) {
+            case NumberKind::Int64:  return static_cast<double>( this->val.i );
+            case NumberKind::UInt64: return static_cast<double>( this->val.u );
+            case NumberKind::Text:   return parseDouble( this->text().data(), this->text().size() );
+            default:                 return this->val.d;
+        }
+    }
+
+    try {
+        return std::stod( this->getAs<std::string>() );
+    }
+    catch ( ... ) { return 0.0; }
+}
+
+// =============================================================================
+// [Utility Methods]
+// =============================================================================
+
+std::size_t Json::size() const noexcept
+{
+    this->load();
+    if( this->jType == JsonType::ARRAY )  return this->val.box->arr.size();
+    if( this->jType == JsonType::OBJECT ) return this->val.box->properties.size();
+    return 0;
+}
+
+std::vector<std::string> Json::keys() const
+{
+    std::vector<std::string> k;
+    this->load();
+    if( this->jType == JsonType::OBJECT ){
+        for( auto& pair : this->val.box->properties ){
+            k.push_back( pair.first.str() );
+        }
+    }
+    return k;
+}
+
+bool Json::contains( StringView key ) const
+{
+    // Object가 아니면 키를 가질 수 없음
+    if( this->jType != JsonType::OBJECT ) {
+        return false;
+    }
+
+    this->load();
+    return this->val.box->find( key ) != Container::NOT_FOUND;
+}
+
+std::string Json::toString( ToStringType type, bool asciiOnly ) const noexcept
+{
+    std::string out;
+    if( type == ToStringType::Pretty )
+        this->writePretty( out, 2, asciiOnly );
+    else
+        this->writeStrip( out, asciiOnly );
+    return out;
+}
+
+bool Json::saveFile( const char* filename ) const
+{
+    std::ofstream file( filename );
+
+    if( !file.is_open() )
+        return false;
+
+    file << this->toString( ToStringType::Pretty );
+    file.close();
+
+    return true;
+}
+
+// =============================================================================
+// [Data Modification]
+// =============================================================================
+
+Json& Json::addObject( const Json& objectValue )
+{
+    // Copies share containers, so this costs no deep copy
+    return this->addObject( Json( objectValue ) );
+}
+
+Json& Json::addObject( Json&& objectValue )
+{
+    // Take the value first: it may live inside this one
+    Json taken( std::move( objectValue ) );
+
+    // [Case 1] Push to Array
+    if( this->jType == JsonType::ARRAY )
+    {
+        this->addElement( std::move( taken ) );
+        return ( *this );
+    }
+
+    // [Case 2] Merge to Object
+    if( taken.isObject() )
+    {
+        this->setType( JsonType::OBJECT );
+        this->load();
+        if( this->val.box->properties.empty() ) {
+            *this = std::move( taken ); // nothing to merge with
+            return ( *this );
+        }
+
+        taken.load();
+        Container& src = taken.unshare(); // sole owner: members can be moved
+        for( auto& prop : src.properties ){
+            this->addProperty( prop.first.view(), &prop.first, std::move( prop.second ) );
+        }
+        return ( *this );
+    }
+
+    throw TinyJsonException( "Cannot add a non-object value to an Object without a key." );
+}
+
+Json& Json::reserve( std::size_t count )
+{
+    if( this->jType == JsonType::ARRAY )
+    {
+        this->load();
+        this->unshare().arr.reserve( count );
+    }
+    else if( this->jType == JsonType::OBJECT )
+    {
+        this->load();
+        this->unshare().properties.reserve( count );
+    }
+    return ( *this );
+}
+
+// =============================================================================
+// [Iteration Methods]
+// =============================================================================
+
+Json::iterator Json::begin()
+{
+    this->load();
+    const bool   isContainer = ( this->jType == JsonType::OBJECT || this->jType == JsonType::ARRAY );
+    JsonArrays&  arr         = isContainer ? this->leak().arr        : emptyElements();
+    JsonObjects& properties  = isContainer ? this->leak().properties : emptyProperties();
+    return iterator( this->jType, arr.begin(), arr.begin(), properties.begin() );
+}
+
+Json::iterator Json::end()
+{
+    this->load();
+    const bool   isContainer = ( this->jType == JsonType::OBJECT || this->jType == JsonType::ARRAY );
+    JsonArrays&  arr         = isContainer ? this->leak().arr        : emptyElements();
+    JsonObjects& properties  = isContainer ? this->leak().properties : emptyProperties();
+    return iterator( this->jType, arr.end(), arr.begin(), properties.end() );
+}
+
+Json::const_iterator Json::begin() const
+{
+    this->load();
+    const bool         isContainer = ( this->jType == JsonType::OBJECT || this->jType == JsonType::ARRAY );
+    const JsonArrays&  arr         = isContainer ? this->leak().arr        : emptyElements();
+    const JsonObjects& properties  = isContainer ? this->leak().properties : emptyProperties();
+    return const_iterator( this->jType, arr.begin(), arr.begin(), properties.begin() );
+}
+
+Json::const_iterator Json::end() const
+{
+    this->load();
+    const bool         isContainer = ( this->jType == JsonType::OBJECT || this->jType == JsonType::ARRAY );
+    const JsonArrays&  arr         = isContainer ? this->leak().arr        : emptyElements();
+    const JsonObjects& properties  = isContainer ? this->leak().properties : emptyProperties();
+    return const_iterator( this->jType, arr.end(), arr.begin(), properties.end() );
+}
+
+Json::ItemsRange<Json::iterator> Json::items()
+{
+    return ItemsRange<iterator>( begin(), end() );
+}
+
+Json::ItemsRange<Json::const_iterator> Json::items() const
+{
+    return ItemsRange<const_iterator>( begin(), end() );
+}
+
+// =============================================================================
+// [Internal Helpers]
+// =============================================================================
+
+void Json::writeStrip( std::string& out, bool asciiOnly ) const
+{
+    this->load();
+    switch( this->jType )
+    {
+    case JsonType::STRING:
+        out += '"';
+        appendEscaped( out, this->text().data(), this->text().size(), asciiOnly );
+        out += '"';
+        break;
+    case JsonType::INT:
+    case JsonType::DOUBLE:    this->appendNumber( out );             break;
+    case JsonType::BOOLEAN:   out += this->val.b ? "true" : "false"; break;
+    case JsonType::NULL_TYPE: out += "null";                         break;
+
+    case JsonType::OBJECT:
+    {
+        const JsonObjects& properties = this->val.box->properties;
+        out += "{ ";
+        for( std::size_t i = 0; i < properties.size(); ++i )
+        {
+            if( i > 0 ) { out += ", "; }
+            out += '"';
+            appendEscaped( out, properties[i].first.data(), properties[i].first.size(), asciiOnly );
+            out += "\": ";
+            properties[i].second.writeStrip( out, asciiOnly );
+        }
+        out += " }";
+        break;
+    }
+
+    case JsonType::ARRAY:
+    {
+        const JsonArrays& arr = this->val.box->arr;
+        out += "[ ";
+        for( std::size_t i = 0; i < arr.size(); ++i )
+        {
+            if( i > 0 ) { out += ", "; }
+            arr[i].writeStrip( out, asciiOnly );
+        }
+        out += " ]";
+        break;
+    }
+
+    default: break;
+    }
+}
+
+void Json::writePretty( std::string& out, const unsigned int space, bool asciiOnly ) const
+{
+    this->load();
+    switch( this->jType )
+    {
+    case JsonType::OBJECT:
+    {
+        const JsonObjects& properties = this->val.box->properties;
+        out += "{\n";
+        for( std::size_t i = 0; i < properties.size(); ++i )
+        {
+            out.append( space, ' ' );
+            out += '"';
+            appendEscaped( out, properties[i].first.data(), properties[i].first.size(), asciiOnly );
+            out += "\": ";
+            properties[i].second.writePretty( out, space + 2, asciiOnly );
+            out += ( i < properties.size() - 1 ) ? ",\n" : "\n";
+        }
+        out.append( space > 2 ? space - 2 : 0, ' ' );
+        out += '}';
+        break;
+    }
+
+    case JsonType::ARRAY:
+    {
+        const JsonArrays& arr = this->val.box->arr;
+        out += "[ ";
+        for( std::size_t i = 0; i < arr.size(); ++i )
+        {
+            if( i > 0 ) { out += ", "; }
+            arr[i].writePretty( out, space, asciiOnly );
+        }
+        out += " ]";
+        break;
+    }
+
+    default:
+        this->writeStrip( out, asciiOnly ); // scalars print the same either way
+        break;
+    }
+}
+
+// Low-level manipulators
+void Json::setString( const std::string& s ) noexcept
+{
+    this->adoptString( SharedString( StringView( s ) ) );
+}
+
+void Json::adoptString( SharedString s ) noexcept
+{
+    this->reset( JsonType::STRING );
+    this->val.str = s.detach();
+}
+
+void Json::reset( const JsonType type )
+{
+    if( this->jType == JsonType::OBJECT || this->jType == JsonType::ARRAY ) {
+        if( this->val.box->refs.fetch_sub( 1, std::memory_order_acq_rel ) == 1 )
+            delete this->val.box;
+    }
+    else if( this->ownsString() )
+        SharedString::release( this->val.str );
+
+    this->jType   = JsonType::UNKNOWN;
+    this->numKind = NumberKind::Int64;
+    this->val.u   = 0;
+
+    if( type == JsonType::OBJECT || type == JsonType::ARRAY )
+        this->val.box = new Container(); // STRING starts empty: a null buffer
+    this->jType = type;
+}
+
+Json& Json::setType( const JsonType type )
+{
+    // A node that becomes something else drops its old payload
+    if( type != this->jType ) this->reset( type );
+    return ( *this );
+}
+
+void Json::setBoolean( bool v ) noexcept
+{
+    this->reset( JsonType::BOOLEAN );
+    this->val.b = v;
+}
+
+void Json::setInteger( int64_t v )
+{
+    this->reset( JsonType::INT );
+    this->val.i = v;
+}
+
+void Json::setUnsigned( uint64_t v )
+{
+    if( v <= static_cast<uint64_t>( INT64_MAX ) ) {
+        this->setInteger( static_cast<int64_t>( v ) );
+        return;
+    }
+    this->reset( JsonType::INT );
+    this->val.u   = v;
+    this->numKind = NumberKind::UInt64;
+}
+
+void Json::setDouble( double v )
+{
+    this->reset( JsonType::DOUBLE );
+    this->val.d   = v;
+    this->numKind = NumberKind::Double;
+}
+
+namespace {
+
+/** @brief Whether `d` truncated toward zero fits in the integer type T. */
+template <typename T>
+bool truncatesInto( double d ) noexcept
+{
+    using Limits = std::numeric_limits<T>;
+
+    // (double)max + 1 is exact for 32-bit T and rounds to 2^64 / 2^63 for 64-bit T
+    const double lo = static_cast<double>( Limits::min() );
+    const double hi = static_cast<double>( Limits::max() ) + 1.0;
+    return ( d > lo - 1.0 || d == lo ) && d < hi;
+}
+
+} // namespace
+
+/**
+ * @brief Converts the native number to an integer type. Doubles are
+ * truncated toward zero, like std::stoi on the text used to be.
+ * @throws TinyJsonException if the value does not fit in T.
+ */
+template <typename T>
+T Json::integerValue() const
+{
+    using Limits = std::numeric_limits<T>;
+    bool fits = false;
+
+    switch( this->numKind )
+    {
+    case NumberKind::Int64:
+        fits = Limits::is_signed
+            ? ( this->val.i >= static_cast<int64_t>( Limits::min() ) && this->val.i <= static_cast<int64_t>( Limits::max() ) )
+            : ( this->val.i >= 0 && static_cast<uint64_t>( this->val.i ) <= static_cast<uint64_t>( Limits::max() ) );
+        if( fits ) return static_cast<T>( this->val.i );
+        break;
+
+    case NumberKind::UInt64:
+        if( this->val.u <= static_cast<uint64_t>( Limits::max() ) )
+            return static_cast<T>( this->val.u );
+        break;
+
+    case NumberKind::Double:
+        if( truncatesInto<T>( this->val.d ) )
+            return static_cast<T>( this->val.d );
+        break;
+
+    case NumberKind::Text: // beyond 64 bits or the double range: fits no integer type
+        break;
+    }
+    throw TinyJsonException( "Number out of range for requested type: " + this->numberText() );
+}
+
+/**
+ * @brief Appends the text of an INT / DOUBLE node: shortest round-trip form
+ * for doubles.
+ */
+void Json::appendNumber( std::string& out ) const
+{
+    char buf[32];
+    switch( this->numKind ) {
+        case NumberKind::Int64:  out.append( buf, writeSigned( buf, this->val.i ) );   break;
+        case NumberKind::UInt64: out.append( buf, writeUnsigned( buf, this->val.u ) ); break;
+        case NumberKind::Double: out.append( buf, writeDouble( buf, this->val.d ) );   break;
+        case NumberKind::Text:   out.append( this->text().data(), this->text().size() ); break;
+    }
+}
+
+std::string Json::numberText() const
+{
+    std::string text;
+    this->appendNumber( text );
+    return text;
+}
+
+Json& Json::addProperty( StringView k, const SharedString* shared, Json&& v )
+{
+    this->setType( JsonType::OBJECT );
+    this->load();
+
+    Container&        c     = this->unshare();
+    const std::size_t found = c.find( k );
+    if( found == Container::NOT_FOUND )
+        return c.append( shared ? *shared : SharedString( k ), std::move( v ) );
+
+    Json& slot = c.properties[found].second;
+    slot = std::move( v );
+    return slot;
+}
+
+Json& Json::addElement( Json&& v )
+{
+    this->setType( JsonType::ARRAY );
+    this->load();
+
+    JsonArrays& arr = this->unshare().arr;
+    arr.push_back( std::move( v ) );
+    return arr.back();
+}
+
+// =============================================================================
+// [JsonPath]
+// =============================================================================
+
+namespace {
+
+[[noreturn]] void invalidPath( StringView path )
+{
+    throw TinyJsonException( "Invalid path: " + path.toString() );
+}
+
+// Decimal digits as an index; false if empty, not all digits or too long
+bool parseIndex( const char* s, const char* e, std::size_t& out ) noexcept
+{
+    if( s == e || e - s > 18 ) return false;
+    out = 0;
+    for( ; s != e; ++s ) {
+        if( *s < '0' || *s > '9' ) return false;
+        out = out * 10 + static_cast<std::size_t>( *s - '0' );
+    }
+    return true;
+}
+
+} // namespace
+
+const std::size_t JsonPath::NO_INDEX;
+
+JsonPath::Step::Step( std::string k, std::size_t i, bool keyed )
+    : key( std::move( k ) ), hash( Json::Container::hashOf( this->key ) ), index( i ), isKey( keyed )
+{
+}
+
+JsonPath::Step::Step( const Step& other )
+    : key( other.key ), hash( other.hash ), index( other.index ), isKey( other.isKey )
+    , hint( other.hint.load( std::memory_order_relaxed ) )
+{
+}
+
+JsonPath::Step& JsonPath::Step::operator=( const Step& other )
+{
+    this->key   = other.key;
+    this->hash  = other.hash;
+    this->index = other.index;
+    this->isKey = other.isKey;
+    this->hint.store( other.hint.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+    return *this;
+}
+
+JsonPath::JsonPath( StringView path )
+    : text( path.toString() )
+{
+    const char*       p   = path.data();
+    const char* const end = p + path.size();
+
+    // JSON Pointer: "/" separated tokens with ~0 ('~') and ~1 ('/') escapes
+    if( p == end || *p == '/' )
+    {
+        while( p != end )
+        {
+            std::string token;
+            for( ++p; p != end && *p != '/'; ++p ) {
+                if( *p != '~' ) {
+                    token += *p;
+                    continue;
+                }
+                if( ++p == end || ( *p != '0' && *p != '1' ) ) invalidPath( path );
+                token += ( *p == '0' ) ? '~' : '/';
+            }
+
+            // "0" or digits without a leading zero may also index an array
+            std::size_t index = NO_INDEX;
+            if( token.size() == 1 || ( !token.empty() && token[0] != '0' ) )
+                if( !parseIndex( token.data(), token.data() + token.size(), index ) ) index = NO_INDEX;
+            this->steps.emplace_back( std::move( token ), index, true );
+        }
+        return;
+    }
+
+    // Dotted: name ( '.' name | '[' digits ']' )*, or a leading "[n]"
+    for( bool first = true; p != end; first = false )
+    {
+        if( *p == '[' ) {
+            const char* const digits = ++p;
+            while( p != end && *p != ']' ) ++p;
+            std::size_t index;
+            if( p == end || !parseIndex( digits, p, index ) ) invalidPath( path );
+            this->steps.emplace_back( std::string(), index, false );
+            ++p; // ']'
+            continue;
+        }
+
+        if( !first ) {
+            if( *p != '.' ) invalidPath( path );
+            ++p;
+        }
+        const char* const name = p;
+        while( p != end && *p != '.' && *p != '[' ) ++p;
+        if( p == name ) invalidPath( path );
+        this->steps.emplace_back( std::string( name, p ), NO_INDEX, true );
+    }
+}
+
+const Json* JsonPath::find( const Json& root ) const
+{
+    const Json* cur = &root;
+    for( const Step& step : this->steps )
+    {
+        cur->load();
+        if( cur->jType == JsonType::OBJECT && step.isKey )
+        {
+            // Same-shaped documents keep members in the same order: try
+            // last time's position before searching
+            const Json::Container& c  = cur->leak(); // the result may be kept
+            std::size_t            at = step.hint.load( std::memory_order_relaxed );
+            if( at >= c.properties.size() || c.properties[at].first.view() != StringView( step.key ) )
+            {
+                at = c.find( step.key, step.hash );
+                if( at == Json::Container::NOT_FOUND ) return nullptr;
+                step.hint.store( static_cast<uint32_t>( at ), std::memory_order_relaxed );
+            }
+            cur = &c.properties[at].second;
+        }
+        else if( cur->jType == JsonType::ARRAY && step.index != NO_INDEX )
+        {
+            const JsonArrays& arr = cur->leak().arr;
+            if( step.index >= arr.size() ) return nullptr;
+            cur = &arr[step.index];
+        }
+        else {
+            return nullptr;
+        }
+    }
+    return cur;
+}
+
+const Json& JsonPath::get( const Json& root ) const
+{
+    const Json* found = this->find( root );
+    if( !found )
+        throw TinyJsonException( "Path not found: " + this->text );
+    return *found;
+}
+
+// =============================================================================
+// [Structural Index (Stage 1)]
+// =============================================================================
+// Before any Json node is built, the input is classified 64 bytes at a time
+// into bit masks (quotes, backslashes, structural characters, whitespace).
+// From those masks we derive which bytes are inside strings and emit the
+// offset of every structural character plus the first byte of every scalar
+// (string, number, literal). The parser then walks this index instead of
+// scanning character by character for the next token.
+
+namespace {
+
+const std::size_t BLOCK_SIZE = 64;
+
+/**
+ * @brief Character classes of one 64-byte block (bit i describes byte i).
+ */
+struct BlockMasks
+{
+    uint64_t quote;     ///< '"'
+    uint64_t backslash; ///< '\\'
+    uint64_t op;        ///< { } [ ] : ,
+    uint64_t space;     ///< ' ', '\t', '\n', '\r'
+};
+
+using ClassifyFn = void (*)( const unsigned char* block, BlockMasks& m );
+
+#if !TINYJSON_X86_64
+void classifyScalar( const unsigned char* in, BlockMasks& m )
+{
+    m = BlockMasks{ 0, 0, 0, 0 };
+
+    for( std::size_t i = 0; i < BLOCK_SIZE; ++i )
+    {
+        const uint64_t bit = uint64_t( 1 ) << i;
+        switch( in[i] ) {
+            case '"':  m.quote     |= bit; break;
+            case '\\': m.backslash |= bit; break;
+            case '{': case '}': case '[': case ']': case ':': case ',':
+                       m.op        |= bit; break;
+            case ' ': case '\t': case '\n': case '\r':
+                       m.space     |= bit; break;
+            default: break;
+        }
+    }
+}
+#endif
+
+#if TINYJSON_X86_64
+void classifySse2( const unsigned char* in, BlockMasks& m )
+{
+    const __m128i quote = _mm_set1_epi8( '"' );
+    const __m128i bs    = _mm_set1_epi8( '\\' );
+    const __m128i comma = _mm_set1_epi8( ',' );
+    const __m128i colon = _mm_set1_epi8( ':' );
+    const __m128i sp    = _mm_set1_epi8( ' ' );
+    const __m128i tab   = _mm_set1_epi8( '\t' );
+    const __m128i lf    = _mm_set1_epi8( '\n' );
+    const __m128i cr    = _mm_set1_epi8( '\r' );
+    // '[' ']' '{' '}' only differ in bit 0x20, so fold case with an OR
+    const __m128i fold  = _mm_set1_epi8( 0x20 );
+    const __m128i brace = _mm_set1_epi8( '{' );
+    const __m128i close = _mm_set1_epi8( '}' );
+
+    m = BlockMasks{ 0, 0, 0, 0 };
+
+    for( int k = 0; k < 4; ++k )
+    {
+        const __m128i v = _mm_loadu_si128( reinterpret_cast<const __m128i*>( in + 16 * k ) );
+        const __m128i f = _mm_or_si128( v, fold );
+
+        const __m128i op = _mm_or_si128(
+            _mm_or_si128( _mm_cmpeq_epi8( f, brace ), _mm_cmpeq_epi8( f, close ) ),
+            _mm_or_si128( _mm_cmpeq_epi8( v, comma ), _mm_cmpeq_epi8( v, colon ) ) );
+        const __m128i ws = _mm_or_si128(
+            _mm_or_si128( _mm_cmpeq_epi8( v, sp ), _mm_cmpeq_epi8( v, tab ) ),
+            _mm_or_si128( _mm_cmpeq_epi8( v, lf ), _mm_cmpeq_epi8( v, cr ) ) );
+
+        const int shift = 16 * k;
+        m.quote     |= uint64_t( uint32_t( _mm_movemask_epi8( _mm_cmpeq_epi8( v, quote ) ) ) ) << shift;
+        m.backslash |= uint64_t( uint32_t( _mm_movemask_epi8( _mm_cmpeq_epi8( v, bs ) ) ) )    << shift;
+        m.op        |= uint64_t( uint32_t( _mm_movemask_epi8( op ) ) ) << shift;
+        m.space     |= uint64_t( uint32_t( _mm_movemask_epi8( ws ) ) ) << shift;
+    }
+}
+#endif
+
+#if TINYJSON_HAS_AVX2
+__attribute__(( target( "avx2" ) ))
+void classifyAvx2( const unsigned char* in, BlockMasks& m )
+{
+    const __m256i quote = _mm256_set1_epi8( '"' );
+    const __m256i bs    = _mm256_set1_epi8( '\\' );
+    const __m256i comma = _mm256_set1_epi8( ',' );
+    const __m256i colon = _mm256_set1_epi8( ':' );
+    const __m256i sp    = _mm256_set1_epi8( ' ' );
+    const __m256i tab   = _mm256_set1_epi8( '\t' );
+    const __m256i lf    = _mm256_set1_epi8( '\n' );
+    const __m256i cr    = _mm256_set1_epi8( '\r' );
+    const __m256i fold  = _mm256_set1_epi8( 0x20 );
+    const __m256i brace = _mm256_set1_epi8( '{' );
+    const __m256i close = _mm256_set1_epi8( '}' );
+
+    m = BlockMasks{ 0, 0, 0, 0 };
+
+    for( int k = 0; k < 2; ++k )
+    {
+        const __m256i v = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( in + 32 * k ) );
+        const __m256i f = _mm256_or_si256( v, fold );
+
+        const __m256i op = _mm256_or_si256(
+            _mm256_or_si256( _mm256_cmpeq_epi8( f, brace ), _mm256_cmpeq_epi8( f, close ) ),
+            _mm256_or_si256( _mm256_cmpeq_epi8( v, comma ), _mm256_cmpeq_epi8( v, colon ) ) );
+        const __m256i ws = _mm256_or_si256(
+            _mm256_or_si256( _mm256_cmpeq_epi8( v, sp ), _mm256_cmpeq_epi8( v, tab ) ),
+            _mm256_or_si256( _mm256_cmpeq_epi8( v, lf ), _mm256_cmpeq_epi8( v, cr ) ) );
+
+        const int shift = 32 * k;
+        m.quote     |= uint64_t( uint32_t( _mm256_movemask_epi8( _mm256_cmpeq_epi8( v, quote ) ) ) ) << shift;
+        m.backslash |= uint64_t( uint32_t( _mm256_movemask_epi8( _mm256_cmpeq_epi8( v, bs ) ) ) )    << shift;
+        m.op        |= uint64_t( uint32_t( _mm256_movemask_epi8( op ) ) ) << shift;
+        m.space     |= uint64_t( uint32_t( _mm256_movemask_epi8( ws ) ) ) << shift;
+    }
+}
+#endif
+
+/**
+ * @brief Picks the widest classifier the running CPU supports (once).
+ */
+ClassifyFn selectClassifier() noexcept
+{
+#if TINYJSON_HAS_AVX2
+    __builtin_cpu_init();
+    if( __builtin_cpu_supports( "avx2" ) )
+        return classifyAvx2;
+#endif
+#if TINYJSON_X86_64
+    return classifySse2;
+#else
+    return classifyScalar;
+#endif
+}
+
+const ClassifyFn classifyBlock = selectClassifier();
+
+/**
+ * @brief Marks bytes preceded by an odd-length run of backslashes.
+ * `carry` is 1 when the previous block ended inside such a run.
+ */
+uint64_t findEscaped( uint64_t backslash, uint64_t& carry ) noexcept
+{
+    const uint64_t evenBits = 0x5555555555555555ULL;
+    const uint64_t oddBits  = ~evenBits;
+
+    const uint64_t startEdges    = backslash & ~( backslash << 1 );
+    const uint64_t evenStartMask = evenBits ^ carry;
+    const uint64_t evenStarts    = startEdges & evenStartMask;
+    const uint64_t oddStarts     = startEdges & ~evenStartMask;
+
+    const uint64_t evenCarries = backslash + evenStarts;
+    uint64_t       oddCarries  = backslash + oddStarts;
+    const bool     endsOdd     = oddCarries < backslash; // overflow
+
+    oddCarries |= carry;
+    carry = endsOdd ? 1 : 0;
+
+    const uint64_t evenCarryEnds = evenCarries & ~backslash;
+    const uint64_t oddCarryEnds  = oddCarries  & ~backslash;
+
+    return ( evenCarryEnds & oddBits ) | ( oddCarryEnds & evenBits );
+}
+
+/**
+ * @brief Inclusive prefix XOR: bit i is the parity of bits [0, i].
+ */
+uint64_t prefixXor( uint64_t x ) noexcept
+{
+    x ^= x << 1;
+    x ^= x << 2;
+    x ^= x << 4;
+    x ^= x << 8;
+    x ^= x << 16;
+    x ^= x << 32;
+    return x;
+}
+
+inline int countTrailingZeros( uint64_t x ) noexcept
+{
+#if defined( __GNUC__ )
+    return __builtin_ctzll( x );
+#else
+    int n = 0;
+    while( !( x & 1 ) ) { x >>= 1; ++n; }
+    return n;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+// UTF-8 validation (optional, see ParseOptions::validateUtf8)
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Checks the UTF-8 sequences that start in [pos, stop) of s[0, length).
+ * Rejects overlong forms, surrogates and code points above U+10FFFF.
+ * @return false with `pos` at the first byte of the malformed sequence;
+ * true with `pos` past the last sequence (which may end beyond `stop`).
+ */
+bool validateUtf8Scalar( const unsigned char* s, std::size_t& pos, std::size_t stop, std::size_t length ) noexcept
+{
+    while( pos < stop )
+    {
+        const unsigned char c = s[pos];
+        if( c < 0x80 ) { ++pos; continue; }
+
+        std::size_t   len = 0;
+        unsigned char lo  = 0x80, hi = 0xBF; // allowed range of the second byte
+        if     ( c >= 0xC2 && c <= 0xDF ) { len = 2; }
+        else if( c == 0xE0 )              { len = 3; lo = 0xA0; } // overlong
+        else if( c == 0xED )              { len = 3; hi = 0x9F; } // surrogates
+        else if( c >= 0xE1 && c <= 0xEF ) { len = 3; }
+        else if( c == 0xF0 )              { len = 4; lo = 0x90; } // overlong
+        else if( c == 0xF4 )              { len = 4; hi = 0x8F; } // > U+10FFFF
+        else if( c >= 0xF1 && c <= 0xF3 ) { len = 4; }
+        else return false;
+
+        if( length - pos < len || s[pos + 1] < lo || s[pos + 1] > hi )
+            return false;
+        for( std::size_t k = 2; k < len; ++k ) {
+            if( ( s[pos + k] & 0xC0 ) != 0x80 ) return false;
+        }
+        pos += len;
+    }
+    return true;
+}
+
+#if TINYJSON_HAS_AVX2
+// Lookup tables of the Keiser-Lemire validator: each error class is a bit,
+// set when the high nibble of a byte, the low nibble of that byte and the
+// high nibble of the next byte all allow it.
+const uint8_t TOO_SHORT      = 1 << 0; // lead byte followed by a non-continuation
+const uint8_t TOO_LONG       = 1 << 1; // ASCII followed by a continuation
+const uint8_t OVERLONG_3     = 1 << 2;
+const uint8_t TOO_LARGE      = 1 << 3;
+const uint8_t SURROGATE      = 1 << 4;
+const uint8_t OVERLONG_2     = 1 << 5;
+const uint8_t TOO_LARGE_1000 = 1 << 6;
+const uint8_t OVERLONG_4     = 1 << 6;
+const uint8_t TWO_CONTS      = 1 << 7; // continuation after a continuation
+const uint8_t CARRY          = TOO_SHORT | TOO_LONG | TWO_CONTS;
+
+alignas( 16 ) const uint8_t UTF8_BYTE1_HIGH[16] = {
+    TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+    TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+    TOO_SHORT | OVERLONG_2,
+    TOO_SHORT,
+    TOO_SHORT | OVERLONG_3 | SURROGATE,
+    TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4
+};
+
+alignas( 16 ) const uint8_t UTF8_BYTE1_LOW[16] = {
+    CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,
+    CARRY | OVERLONG_2,
+    CARRY,
+    CARRY,
+    CARRY | TOO_LARGE,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000
+};
+
+alignas( 16 ) const uint8_t UTF8_BYTE2_HIGH[16] = {
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4,
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE  | TOO_LARGE,
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE  | TOO_LARGE,
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT
+};
+
+__attribute__(( target( "avx2" ) ))
+__m256i utf8Lookup( const uint8_t* table, __m256i nibbles )
+{
+    const __m256i t = _mm256_broadcastsi128_si256( _mm_load_si128( reinterpret_cast<const __m128i*>( table ) ) );
+    return _mm256_shuffle_epi8( t, nibbles );
+}
+
+/**
+ * @brief Non-zero bytes mark malformed UTF-8 in `input`, given the 32 bytes
+ * that precede it.
+ */
+__attribute__(( target( "avx2" ) ))
+__m256i utf8Errors( __m256i input, __m256i prevInput )
+{
+    const __m256i low4 = _mm256_set1_epi8( 0x0F );
+
+    // input shifted right by 1..3 bytes, with the tail of prevInput shifted in
+    const __m256i carry = _mm256_permute2x128_si256( prevInput, input, 0x21 );
+    const __m256i prev1 = _mm256_alignr_epi8( input, carry, 15 );
+    const __m256i prev2 = _mm256_alignr_epi8( input, carry, 14 );
+    const __m256i prev3 = _mm256_alignr_epi8( input, carry, 13 );
+
+    const __m256i special = _mm256_and_si256(
+        _mm256_and_si256( utf8Lookup( UTF8_BYTE1_HIGH, _mm256_and_si256( _mm256_srli_epi16( prev1, 4 ), low4 ) ),
+                          utf8Lookup( UTF8_BYTE1_LOW,  _mm256_and_si256( prev1, low4 ) ) ),
+        utf8Lookup( UTF8_BYTE2_HIGH, _mm256_and_si256( _mm256_srli_epi16( input, 4 ), low4 ) ) );
+
+    // Third and fourth bytes of 3- and 4-byte sequences must be continuations
+    const __m256i must23 = _mm256_or_si256(
+        _mm256_subs_epu8( prev2, _mm256_set1_epi8( static_cast<char>( 0xE0 - 0x80 ) ) ),
+        _mm256_subs_epu8( prev3, _mm256_set1_epi8( static_cast<char>( 0xF0 - 0x80 ) ) ) );
+
+    return _mm256_xor_si256( _mm256_and_si256( must23, _mm256_set1_epi8( static_cast<char>( 0x80 ) ) ), special );
+}
+
+/**
+ * @brief Validates one 64-byte block; `prev` holds the previous block's last
+ * 32 bytes and is updated.
+ */
+__attribute__(( target( "avx2" ) ))
+bool utf8BlockAvx2( const unsigned char* block, unsigned char* prev )
+{
+    const __m256i a = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( block ) );
+    const __m256i b = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( block + 32 ) );
+    const __m256i p = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( prev ) );
+
+    __m256i error;
+    if( _mm256_movemask_epi8( _mm256_or_si256( a, b ) ) == 0 ) {
+        // ASCII only: fails just when the previous block ends mid-sequence
+        const __m256i maxTail = _mm256_setr_epi8(
+            -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+            -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+            static_cast<char>( 0xF0 - 1 ), static_cast<char>( 0xE0 - 1 ), static_cast<char>( 0xC0 - 1 ) );
+        error = _mm256_subs_epu8( p, maxTail );
+    } else {
+        error = _mm256_or_si256( utf8Errors( a, p ), utf8Errors( b, a ) );
+    }
+
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( prev ), b );
+    return _mm256_testz_si256( error, error ) != 0;
+}
+
+bool detectAvx2() noexcept
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports( "avx2" ) != 0;
+}
+
+const bool UTF8_USE_AVX2 = detectAvx2();
+#endif
+
+/**
+ * @brief UTF-8 check run by stage 1 on each block it has just classified,
+ * so the input is read once. Without AVX2, all-ASCII blocks are skipped
+ * and the others are checked byte by byte.
+ */
+class Utf8Validator
+{
+public:
+    Utf8Validator( const unsigned char* data, std::size_t length ) noexcept
+        : data( data ), length( length )
+    {}
+
+    /// `block` holds the 64 bytes at `base` (padded with spaces at the end)
+    bool check( const unsigned char* block, std::size_t base ) noexcept
+    {
+#if TINYJSON_HAS_AVX2
+        if( UTF8_USE_AVX2 )
+            return utf8BlockAvx2( block, this->prev );
+#endif
+        uint64_t high = 0;
+        for( int k = 0; k < 8; ++k ) {
+            uint64_t w;
+            std::memcpy( &w, block + 8 * k, sizeof( w ) );
+            high |= w;
+        }
+        if( ( high & 0x8080808080808080ULL ) == 0 && this->pos <= base )
+            return true;
+
+        this->pos = std::max( this->pos, base );
+        return validateUtf8Scalar( this->data, this->pos, std::min( base + 64, this->length ), this->length );
+    }
+
+    /// Rejects a sequence cut off by the end of the input
+    bool finish() const noexcept
+    {
+#if TINYJSON_HAS_AVX2
+        if( UTF8_USE_AVX2 )
+            return this->prev[31] < 0xC0 && this->prev[30] < 0xE0 && this->prev[29] < 0xF0;
+#endif
+        return true;
+    }
+
+private:
+    const unsigned char* data;
+    std::size_t          length;
+    std::size_t          pos = 0;       // scalar path: end of the checked sequences
+    unsigned char        prev[32] = {}; // AVX2 path: tail of the previous block
+};
+
+/**
+ * @brief Offset of the first malformed UTF-8 sequence (for error messages).
+ */
+std::size_t firstInvalidUtf8( const char* data, std::size_t length ) noexcept
+{
+    std::size_t pos = 0;
+    validateUtf8Scalar( reinterpret_cast<const unsigned char*>( data ), pos, length, length );
+    return pos;
+}
+
+/// buildStructuralIndex() results that are not an offset count
+const std::ptrdiff_t INDEX_UNTERMINATED = -1;
+const std::ptrdiff_t INDEX_BAD_UTF8     = -2;
+
+/**
+ * @brief Writes the offsets of all structural bytes of `data` into `out`
+ * (which must hold `length + 1` entries). With a validator, the input is
+ * also checked to be well-formed UTF-8.
+ * @return Number of offsets written, INDEX_UNTERMINATED if a string is left
+ * unterminated, or INDEX_BAD_UTF8.
+ */
+std::ptrdiff_t buildStructuralIndex( const char* data, std::size_t length, uint32_t* out,
+                                     Utf8Validator* utf8 = nullptr ) noexcept
+{
+    const unsigned char* in = reinterpret_cast<const unsigned char*>( data );
+    uint32_t* const first = out;
+
+    uint64_t escapeCarry = 0; // previous block ended in an odd backslash run
+    uint64_t inString    = 0; // all ones if previous block ended inside a string
+    uint64_t scalarCarry = 0; // previous block ended with a non-quote scalar byte
+
+    unsigned char tail[BLOCK_SIZE];
+    BlockMasks    m;
+
+    for( std::size_t base = 0; base < length; base += BLOCK_SIZE )
+    {
+        const unsigned char* block = in + base;
+        if( length - base < BLOCK_SIZE ) {
+            // Pad the last partial block with whitespace
+            std::memset( tail, ' ', BLOCK_SIZE );
+            std::memcpy( tail, block, length - base );
+            block = tail;
+        }
+        classifyBlock( block, m );
+        if( utf8 && !utf8->check( block, base ) )
+            return INDEX_BAD_UTF8;
+
+        const uint64_t escaped = ( m.backslash | escapeCarry ) ? findEscaped( m.backslash, escapeCarry ) : 0;
+        const uint64_t quote   = m.quote & ~escaped;
+
+        // Bits from an opening quote up to (not including) its closing quote
+        const uint64_t strings = prefixXor( quote ) ^ inString;
+        inString = uint64_t( int64_t( strings ) >> 63 );
+
+        // A scalar starts where a non-op, non-space byte does not directly
+        // follow another non-quote scalar byte
+        const uint64_t scalar         = ~( m.op | m.space );
+        const uint64_t nonQuoteScalar = scalar & ~quote;
+        const uint64_t follows        = ( nonQuoteScalar << 1 ) | scalarCarry;
+        scalarCarry = nonQuoteScalar >> 63;
+
+        // Keep opening quotes, drop everything else inside strings
+        const uint64_t stringTail = strings ^ quote;
+        uint64_t structurals = ( m.op | ( scalar & ~follows ) ) & ~stringTail;
+
+        if( length - base < BLOCK_SIZE )
+            structurals &= ( uint64_t( 1 ) << ( length - base ) ) - 1;
+
+        while( structurals ) {
+            *out++ = static_cast<uint32_t>( base + countTrailingZeros( structurals ) );
+            structurals &= structurals - 1;
+        }
+    }
+
+    if( utf8 && !utf8->finish() )
+        return INDEX_BAD_UTF8;
+    if( inString )
+        return INDEX_UNTERMINATED;
+    return out - first;
+}
+
+} // namespace
+
+// =============================================================================
+// [Parser Implementation]
+// =============================================================================
+
+const char* ParseResult::message() const noexcept
+{
+    switch( this->error ) {
+        case ParseError::None:                 return "No error";
+        case ParseError::UnexpectedEnd:        return "Unexpected end of input";
+        case ParseError::InvalidCharacter:     return "Invalid character in JSON";
+        case ParseError::InvalidNumber:        return "Invalid number";
+        case ParseError::LeadingZero:          return "Leading zeros are not allowed in numbers";
+        case ParseError::MissingFraction:      return "Expected digit after decimal point";
+        case ParseError::MissingExponent:      return "Expected digit in exponent";
+        case ParseError::InvalidEscape:        return "Invalid escape sequence in string";
+        case ParseError::InvalidUnicodeEscape: return "Invalid \\u escape in string";
+        case ParseError::ControlCharacter:     return "Unescaped control character in string";
+        case ParseError::UnterminatedString:   return "Unterminated string";
+        case ParseError::ExpectedKey:          return "Expected string key in object";
+        case ParseError::ExpectedColon:        return "Expected ':' after key in object";
+        case ParseError::ExpectedObjectEnd:    return "Expected ',' or '}' after property in object";
+        case ParseError::ExpectedArrayEnd:     return "Expected ',' or ']' after element in array";
+        case ParseError::MismatchedBrackets:   return "Mismatched brackets or braces in JSON";
+        case ParseError::TrailingCharacters:   return "Unexpected trailing characters after JSON value";
+        case ParseError::DepthExceeded:        return "Maximum nesting depth exceeded";
+        case ParseError::InvalidUtf8:          return "Invalid UTF-8";
+        case ParseError::InputTooLarge:        return "Input larger than 4 GiB is not supported";
+        case ParseError::DocumentTooLarge:     return "Container or string too large for a TapeDocument";
+        case ParseError::OutOfMemory:          return "Out of memory";
+    }
+    return "Unknown error";
+}
+
+namespace {
+
+/**
+ * @brief A failed ParseResult, with the line and column of `offset` in `data`.
+ */
+ParseResult parseFailure( ParseError error, std::size_t offset, const char* data ) noexcept
+{
+    ParseResult result{ error, offset, 1, 1 };
+    const char* const end = data + offset;
+    for( const char* p = data; ( p = static_cast<const char*>( std::memchr( p, '\n', end - p ) ) ) != nullptr; ++p ) {
+        ++result.line;
+        result.column = static_cast<std::size_t>( end - p ); // 1 + bytes after the newline
+    }
+    if( result.line == 1 )
+        result.column = offset + 1;
+    return result;
+}
+
+std::string describeError( const ParseResult& result )
+{
+    return std::string( result.message() ) + " (at offset " + std::to_string( result.offset ) + ")";
+}
+
+[[noreturn]] void throwParseError( const ParseResult& result )
+{
+    throw TinyJsonException( "Parse Error: " + describeError( result ) );
+}
+
+} // namespace
+
+/**
+ * @brief Walks the structural index produced by stage 1.
+ * `tok` points at the offset of the next structural byte.
+ */
+struct Parser::Cursor
+{
+    Cursor( const char* data, std::size_t length, const uint32_t* index, std::size_t count )
+        : begin( data ), end( data + length ), tok( index ), tokEnd( index + count )
+    {}
+
+    bool        atEnd() const noexcept { return tok >= tokEnd; }
+    char        peek()  const noexcept { return begin[*tok]; }
+    const char* here()  const noexcept { return begin + *tok; }
+
+    /// Records the first error at the current token; always returns false
+    bool fail( ParseError e ) noexcept
+    {
+        error   = e;
+        errorAt = base + ( atEnd() ? end - begin : *tok );
+        return false;
+    }
+
+    const char*       begin;
+    const char*       end;
+    const uint32_t*   tok;
+    const uint32_t*   tokEnd;
+    std::size_t       base     = 0; // offset of `begin` in the whole text (for errors)
+    std::size_t       maxDepth = ParseOptions().maxDepth;
+    std::vector<char> stack;        // parseValue's open containers, reused per value
+    ParseError        error   = ParseError::None;
+    std::size_t       errorAt = 0;
+};
+
+namespace {
+
+inline bool isJsonSpace( char c ) noexcept
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+inline bool isDelimiter( const char c ) noexcept
+{
+    switch( c ) {
+        case ' ': case '\t': case '\n': case '\r':
+        case ',': case ':': case '[': case ']': case '{': case '}':
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief True if [p, end) starts with `word` followed by a delimiter or the end.
+ */
+inline bool matchLiteral( const char* p, const char* end, const char* word, std::size_t len ) noexcept
+{
+    return static_cast<std::size_t>( end - p ) >= len
+        && std::memcmp( p, word, len ) == 0
+        && ( p + len == end || isDelimiter( p[len] ) );
+}
+
+/**
+ * @brief Matches -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)? at `p`.
+ * @return One past the number, or nullptr with `error` set.
+ */
+const char* matchNumber( const char* p, const char* end, JsonType& type, ParseError& error ) noexcept
+{
+    auto isDigit = [end]( const char* q ) { return q < end && *q >= '0' && *q <= '9'; };
+    type = JsonType::INT;
+
+    if( p < end && *p == '-' ) ++p;
+
+    if( !isDigit( p ) ) {
+        error = ParseError::InvalidNumber;
+        return nullptr;
+    }
+    if( *p == '0' ) {
+        ++p;
+        if( isDigit( p ) ) {
+            error = ParseError::LeadingZero;
+            return nullptr;
+        }
+    } else {
+        while( isDigit( p ) ) ++p;
+    }
+
+    if( p < end && *p == '.' ) {
+        type = JsonType::DOUBLE;
+        ++p;
+        if( !isDigit( p ) ) {
+            error = ParseError::MissingFraction;
+            return nullptr;
+        }
+        while( isDigit( p ) ) ++p;
+    }
+
+    if( p < end && ( *p == 'e' || *p == 'E' ) ) {
+        type = JsonType::DOUBLE;
+        ++p;
+        if( p < end && ( *p == '+' || *p == '-' ) ) ++p;
+        if( !isDigit( p ) ) {
+            error = ParseError::MissingExponent;
+            return nullptr;
+        }
+        while( isDigit( p ) ) ++p;
+    }
+    return p;
+}
+
+// -----------------------------------------------------------------------------
+// Validation only (Parser::isObject)
+// -----------------------------------------------------------------------------
+
+/// Nesting accepted by validateJson (the ParseOptions default)
+const std::size_t VALIDATE_MAX_DEPTH = 1024;
+
+/**
+ * @brief Skips the string starting at the '"' under `p`, checking its escapes.
+ */
+bool skipString( const char*& p, const char* end ) noexcept
+{
+    ++p;
+    while( true )
+    {
+        p += cleanRun( reinterpret_cast<const unsigned char*>( p ), end - p, false );
+        if( p == end ) return false;
+
+        const char c = *p++;
+        if( c == '"' ) return true;
+        if( c != '\\' || p == end ) return false; // control character
+
+        switch( *p++ ) {
+            case '"': case '\\': case '/':
+            case 'b': case 'f': case 'n': case 'r': case 't':
+                break;
+            case 'u':
+                for( int k = 0; k < 4; ++k, ++p ) {
+                    if( p == end || !isxdigit( static_cast<unsigned char>( *p ) ) ) return false;
+                }
+                break;
+            default:
+                return false;
+        }
+    }
+}
+
+/**
+ * @brief Skips an object key and the ':' after it.
+ */
+bool skipKey( const char*& p, const char* end ) noexcept
+{
+    while( p < end && isJsonSpace( *p ) ) ++p;
+    if( p == end || *p != '"' || !skipString( p, end ) ) return false;
+    while( p < end && isJsonSpace( *p ) ) ++p;
+    if( p == end || *p != ':' ) return false;
+    ++p;
+    return true;
+}
+
+/**
+ * @brief True if [p, end) is exactly one JSON value with optional
+ * whitespace around it. Accepts the same input as Parser::parse, but
+ * builds nothing and allocates nothing: open containers are kept as bits
+ * (1 = object) in a fixed stack.
+ */
+bool validateJson( const char* p, const char* const end ) noexcept
+{
+    uint64_t    isObj[VALIDATE_MAX_DEPTH / 64] = {};
+    std::size_t depth = 0;
+
+    while( true )
+    {
+        // A value
+        while( p < end && isJsonSpace( *p ) ) ++p;
+        if( p == end ) return false;
+
+        const char c = *p;
+        if( c == '{' || c == '[' )
+        {
+            if( depth == VALIDATE_MAX_DEPTH ) return false;
+            ++p;
+            while( p < end && isJsonSpace( *p ) ) ++p;
+            if( p == end || *p != ( c == '{' ? '}' : ']' ) ) {
+                const uint64_t bit = uint64_t( 1 ) << ( depth % 64 );
+                if( c == '{' ) isObj[depth / 64] |= bit;
+                else           isObj[depth / 64] &= ~bit;
+                ++depth;
+                if( c == '{' && !skipKey( p, end ) ) return false;
+                continue;
+            }
+            ++p; // empty container
+        }
+        else if( c == '"' ) {
+            if( !skipString( p, end ) ) return false;
+        }
+        else if( c == 't' || c == 'f' || c == 'n' ) {
+            const char*       word = ( c == 't' ) ? "true" : ( c == 'f' ) ? "false" : "null";
+            const std::size_t len  = ( c == 'f' ) ? 5 : 4;
+            if( !matchLiteral( p, end, word, len ) ) return false;
+            p += len;
+        }
+        else {
+            JsonType    type  = JsonType::INT;
+            ParseError  error = ParseError::None;
+            const char* q     = matchNumber( p, end, type, error );
+            if( !q || ( q < end && !isDelimiter( *q ) ) ) return false;
+            p = q;
+        }
+
+        // After a value: close finished containers, or move on to the next member
+        while( true )
+        {
+            while( p < end && isJsonSpace( *p ) ) ++p;
+            if( depth == 0 ) return p == end;
+            if( p == end ) return false;
+
+            const bool obj = ( isObj[( depth - 1 ) / 64] >> ( ( depth - 1 ) % 64 ) ) & 1;
+            if( *p == ',' ) {
+                ++p;
+                if( obj && !skipKey( p, end ) ) return false;
+                break;
+            }
+            if( *p != ( obj ? '}' : ']' ) ) return false;
+            ++p;
+            --depth;
+        }
+    }
+}
+
+/**
+ * @brief Copies a number's text to a terminated local buffer (the view is
+ * not null-terminated) and converts it with strtod / strtoll.
+ */
+template <typename T, typename Convert>
+T convertText( StringView text, Convert convert )
+{
+    char local[64];
+    std::string heap;
+    const char* cstr = local;
+
+    if( text.size() < sizeof( local ) ) {
+        std::memcpy( local, text.data(), text.size() );
+        local[text.size()] = '\0';
+    } else {
+        heap = text.toString();
+        cstr = heap.c_str();
+    }
+
+    char* endPtr = nullptr;
+    const T value = convert( cstr, &endPtr );
+    return ( endPtr == cstr ) ? T() : value;
+}
+
+} // namespace
+
+bool Parser::isObject( const std::string& str ) noexcept
+{
+    return validateJson( str.data(), str.data() + str.size() );
+}
+
+bool Parser::isObject( const char* str ) noexcept
+{
+    return validateJson( str, str + std::strlen( str ) );
+}
+
+// -----------------------------------------------------------------------------
+// Builders: turn parse events into a concrete document
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Builds a Json tree. Containers being filled are kept on a stack;
+ * each new value is constructed in place inside its parent.
+ */
+class Parser::DomBuilder
+{
+public:
+    DomBuilder( Json& root, KeyCache& keys ) : root( root ), keys( keys ) {}
+
+    void reserve( std::size_t ) {}
+
+    // Bracket positions are not needed (StreamParser passes none)
+    void beginObject( const char* = nullptr ) { open( JsonType::OBJECT ); }
+    void endObject  ( const char* = nullptr ) { stack.pop_back(); }
+    void beginArray ( const char* = nullptr ) { open( JsonType::ARRAY ); }
+    void endArray   ( const char* = nullptr ) { stack.pop_back(); }
+
+    // Keys and strings are stored decoded, as setString() stores them
+    void key   ( const char* s, std::size_t n, bool escaped ) { assignUnescaped( pendingKey, s, n, escaped ); }
+    void string( const char* s, std::size_t n, bool escaped ) { next().adoptString( keys.value( s, n, escaped ) ); }
+    void number ( const char* s, std::size_t n, JsonType type ) { next().setNumber( s, n, type ); }
+    void boolean( bool v ) { next().setBoolean( v ); }
+    void null()            { next().setType( JsonType::NULL_TYPE ); }
+
+private:
+    void open( JsonType type )
+    {
+        Json& node = next();
+        node.setType( type );
+        stack.push_back( &node );
+    }
+
+    Json& next()
+    {
+        if( stack.empty() )
+            return root;
+
+        Json&            parent = *stack.back();
+        Json::Container& c      = *parent.val.box;
+        if( parent.jType == JsonType::ARRAY ) {
+            c.arr.emplace_back( JsonType::UNKNOWN );
+            return c.arr.back();
+        }
+
+        // Duplicate keys overwrite the earlier value, as addProperty() does
+        const std::size_t found = c.find( pendingKey );
+        if( found != Json::Container::NOT_FOUND ) {
+            Json& slot = c.properties[found].second;
+            slot.reset( JsonType::UNKNOWN );
+            return slot;
+        }
+        return c.append( keys.key( pendingKey ), Json() );
+    }
+
+    Json&              root;
+    KeyCache&          keys;
+    std::vector<Json*> stack;
+    std::string        pendingKey;
+};
+
+namespace {
+
+/**
+ * @brief Resolves duplicate keys in flat documents (ViewDocument nodes,
+ * TapeDocument words) the way Json does: each key stays at its first
+ * position and takes the value of its last occurrence. A member is one key
+ * item followed by its value's items; the object's members start at
+ * keyAt[0 .. n) and the last one runs to the end of `items`, so an object
+ * is resolved as it closes. Reused by one builder across objects.
+ */
+template <typename Item>
+class DuplicateKeys
+{
+public:
+    /** @brief Rewrites the members if keys repeat; returns the member count left. */
+    template <typename Items, typename KeyOf>
+    std::size_t resolve( Items& items, const std::size_t* keyAt, std::size_t n, KeyOf keyOf )
+    {
+        if( n < 2 || !this->find( keyAt, n, keyOf ) )
+            return n;
+
+        // Members are moved around, so work from a copy of the object's items
+        const std::size_t from = keyAt[0];
+        this->scratch.assign( items.begin() + from, items.end() );
+
+        this->last.assign( n, 0 );
+        for( std::size_t i = 0; i < n; ++i )
+            this->last[this->first[i]] = i;
+
+        std::size_t to = from, left = 0;
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            if( this->first[i] != i ) continue;
+            const std::size_t v   = this->last[i];
+            const std::size_t end = ( v + 1 < n ) ? keyAt[v + 1] - from : this->scratch.size();
+
+            items[to++] = this->scratch[keyAt[i] - from];
+            for( std::size_t k = keyAt[v] - from + 1; k < end; ++k )
+                items[to++] = this->scratch[k];
+            ++left;
+        }
+        items.erase( items.begin() + to, items.end() );
+        return left;
+    }
+
+private:
+    // first[i]: the member whose key member i repeats (i itself if none)
+    template <typename KeyOf>
+    bool find( const std::size_t* keyAt, std::size_t n, KeyOf keyOf )
+    {
+        this->first.resize( n );
+        bool repeated = false;
+
+        if( n <= LINEAR_MAX )
+        {
+            for( std::size_t i = 0; i < n; ++i ) {
+                this->first[i] = i;
+                const StringView key = keyOf( keyAt[i] );
+                for( std::size_t j = 0; j < i; ++j ) {
+                    if( keyOf( keyAt[j] ) == key ) {
+                        this->first[i] = j;
+                        repeated = true;
+                        break;
+                    }
+                }
+            }
+            return repeated;
+        }
+
+        this->seen.clear();
+        for( std::size_t i = 0; i < n; ++i ) {
+            auto r = this->seen.emplace( keyOf( keyAt[i] ), i );
+            this->first[i] = r.first->second;
+            repeated = repeated || !r.second;
+        }
+        return repeated;
+    }
+
+    // Small objects are compared pairwise instead of hashed
+    static const std::size_t LINEAR_MAX = 16;
+
+    std::vector<Item>                                    scratch;
+    std::vector<std::size_t>                             first;
+    std::vector<std::size_t>                             last;
+    std::unordered_map<StringView, std::size_t, KeyHash> seen;
+};
+
+} // namespace
+
+/**
+ * @brief Builds a ViewDocument whose text stays in the (mutable) input buffer.
+ * Duplicate keys are resolved when their object closes, as Json does.
+ */
+class Parser::ViewBuilder
+{
+public:
+    ViewBuilder( ViewDocument& doc, char* buffer )
+        : nodes( doc.nodes ), buffer( buffer )
+    {}
+
+    // Every node starts at a structural byte, so their count bounds ours
+    void reserve( std::size_t structurals ) { nodes.reserve( structurals ); }
+
+    void beginObject( const char* ) { open( JsonType::OBJECT ); }
+    void endObject  ( const char* ) { close(); }
+    void beginArray ( const char* ) { open( JsonType::ARRAY ); }
+    void endArray   ( const char* ) { close(); }
+
+    void key( const char* s, std::size_t n, bool escaped )
+    {
+        keyAt.push_back( nodes.size() );
+        push( JsonType::STRING, text( s, n, escaped ) );
+    }
+
+    void string( const char* s, std::size_t n, bool escaped )
+    {
+        countChild();
+        push( JsonType::STRING, text( s, n, escaped ) );
+    }
+
+    void number( const char* s, std::size_t n, JsonType type )
+    {
+        countChild();
+        push( type, StringView( s, n ) );
+    }
+
+    void boolean( bool v ) { countChild(); push( JsonType::BOOLEAN,   v ? "true" : "false" ); }
+    void null()            { countChild(); push( JsonType::NULL_TYPE, "null" ); }
+
+private:
+    void push( JsonType type, StringView str )
+    {
+        nodes.push_back( ViewDocument::Node{ type, 1, 0, str.data(), str.size() } );
+    }
+
+    void countChild()
+    {
+        if( !openNodes.empty() )
+            ++nodes[openNodes.back().at].count;
+    }
+
+    void open( JsonType type )
+    {
+        countChild();
+        openNodes.push_back( Open{ nodes.size(), keyAt.size() } );
+        push( type, StringView() );
+    }
+
+    void close()
+    {
+        const Open o = openNodes.back();
+        if( nodes[o.at].type == JsonType::OBJECT ) {
+            const std::size_t left = duplicates.resolve( nodes, keyAt.data() + o.firstKey, keyAt.size() - o.firstKey,
+                [this]( std::size_t at ) { return StringView( nodes[at].str, nodes[at].len ); } );
+            nodes[o.at].count = static_cast<uint32_t>( left );
+            keyAt.resize( o.firstKey );
+        }
+
+        nodes[o.at].span = static_cast<uint32_t>( nodes.size() - o.at );
+        openNodes.pop_back();
+    }
+
+    /**
+     * @brief Decodes escapes in place and terminates the string where its
+     * closing quote (or a byte freed by decoding) was.
+     */
+    StringView text( const char* s, std::size_t n, bool escaped )
+    {
+        char* const first = buffer + ( s - buffer );
+        char* const last  = escaped ? unescapeTo( first, first + n, first ) : first + n;
+        *last = '\0';
+        return StringView( first, last - first );
+    }
+
+    struct Open {
+        std::size_t at;       // index of the container node
+        std::size_t firstKey; // its members' entries in keyAt (objects)
+    };
+
+    std::vector<ViewDocument::Node, ArenaAllocator<ViewDocument::Node>>& nodes;
+    std::vector<Open>                                                     openNodes;
+    std::vector<std::size_t>                                              keyAt; // key nodes of open objects
+    DuplicateKeys<ViewDocument::Node>                                     duplicates;
+    char* const                                                           buffer;
+};
+
+/**
+ * @brief Writes a TapeDocument: one word per key, string, literal and
+ * container, two per number. Containers are patched with their count and
+ * span when they close; text is copied (and decoded) into the string buffer,
+ * where each distinct key is stored once. Duplicate keys are resolved when
+ * their object closes, as Json does.
+ */
+class Parser::TapeBuilder
+{
+public:
+    /// Thrown when a span or a string outgrows its 32-bit field; caught by Parser::tryParse
+    struct TooLarge {};
+
+    explicit TapeBuilder( TapeDocument& doc )
+        : tape( doc.tape ), strings( doc.strings )
+    {}
+
+    // Every value starts at a structural byte; numbers take a second word
+    void reserve( std::size_t structurals ) { tape.reserve( structurals ); }
+
+    void beginObject( const char* ) { open( TapeDocument::TagObject ); }
+    void endObject  ( const char* ) { close(); }
+    void beginArray ( const char* ) { open( TapeDocument::TagArray ); }
+    void endArray   ( const char* ) { close(); }
+
+    void key( const char* s, std::size_t n, bool escaped )
+    {
+        uint64_t at;
+        if( escaped ) {
+            at = text( s, n, true );
+        } else {
+            // Keyed by the input text, which outlives the builder
+            auto it = keys.find( StringView( s, n ) );
+            if( it == keys.end() ) {
+                if( keys.size() >= MAX_KEYS ) keys.clear();
+                it = keys.emplace( StringView( s, n ), text( s, n, false ) ).first;
+            }
+            at = it->second;
+        }
+        keyAt.push_back( tape.size() );
+        tape.push_back( TapeDocument::word( TapeDocument::TagString, at ) );
+    }
+
+    // Frozen from here on: drop the slack of geometric growth
+    void finish()
+    {
+        tape.shrink_to_fit();
+        strings.shrink_to_fit();
+    }
+
+    void string( const char* s, std::size_t n, bool escaped )
+    {
+        countChild();
+        tape.push_back( TapeDocument::word( TapeDocument::TagString, text( s, n, escaped ) ) );
+    }
+
+    void number( const char* s, std::size_t n, JsonType type )
+    {
+        countChild();
+        int64_t  i = 0;
+        uint64_t u = 0;
+        if( type == JsonType::INT && parseInt64( s, n, i ) ) {
+            push( TapeDocument::TagInt64, static_cast<uint64_t>( i ) );
+        } else if( type == JsonType::INT && *s != '-' && parseUInt64( s, n, u ) ) {
+            push( TapeDocument::TagUInt64, u );
+        } else if( type == JsonType::INT ) {
+            tape.push_back( TapeDocument::word( TapeDocument::TagBigInt, text( s, n, false ) ) );
+        } else {
+            const double d = parseDouble( s, n );
+            if( std::isinf( d ) ) { // kept as text, as Json does
+                tape.push_back( TapeDocument::word( TapeDocument::TagBigDouble, text( s, n, false ) ) );
+                return;
+            }
+            std::memcpy( &u, &d, sizeof( u ) );
+            push( TapeDocument::TagDouble, u );
+        }
+    }
+
+    void boolean( bool v ) { countChild(); tape.push_back( TapeDocument::word( v ? TapeDocument::TagTrue : TapeDocument::TagFalse, 0 ) ); }
+    void null()            { countChild(); tape.push_back( TapeDocument::word( TapeDocument::TagNull, 0 ) ); }
+
+private:
+    struct Open {
+        std::size_t at;       // tape index of the container word
+        uint32_t    count;    // children so far
+        std::size_t firstKey; // its members' entries in keyAt (objects)
+    };
+
+    void push( TapeDocument::Tag tag, uint64_t value )
+    {
+        tape.push_back( TapeDocument::word( tag, 0 ) );
+        tape.push_back( value );
+    }
+
+    void countChild()
+    {
+        if( !openNodes.empty() && openNodes.back().count < TapeDocument::COUNT_SATURATED )
+            ++openNodes.back().count;
+    }
+
+    void open( TapeDocument::Tag tag )
+    {
+        countChild();
+        openNodes.push_back( Open{ tape.size(), 0, keyAt.size() } );
+        tape.push_back( TapeDocument::word( tag, 0 ) );
+    }
+
+    void close()
+    {
+        Open o = openNodes.back();
+        if( TapeDocument::tagOf( tape[o.at] ) == TapeDocument::TagObject ) {
+            const std::size_t left = duplicates.resolve( tape, keyAt.data() + o.firstKey, keyAt.size() - o.firstKey,
+                [this]( std::size_t at ) { return keyText( tape[at] ); } );
+            o.count = static_cast<uint32_t>( std::min<std::size_t>( left, TapeDocument::COUNT_SATURATED ) );
+            keyAt.resize( o.firstKey );
+        }
+
+        const std::size_t span = tape.size() - o.at;
+        if( span > 0xFFFFFFFFu )
+            throw TooLarge(); // spans are 32-bit
+        tape[o.at] |= ( static_cast<uint64_t>( o.count ) << 32 ) | span;
+        openNodes.pop_back();
+    }
+
+    StringView keyText( uint64_t w ) const noexcept
+    {
+        const char* at = strings.data() + TapeDocument::payloadOf( w );
+        uint32_t    len;
+        std::memcpy( &len, at, sizeof( len ) );
+        return StringView( at + sizeof( len ), len );
+    }
+
+    // Appends length, bytes and '\0' to the string buffer; returns the offset
+    uint64_t text( const char* s, std::size_t n, bool escaped )
+    {
+        if( n > 0xFFFFFFFFu )
+            throw TooLarge(); // lengths are 32-bit
+        const std::size_t at = strings.size();
+        strings.resize( at + sizeof( uint32_t ) + n + 1 );
+
+        char* const first = &strings[at + sizeof( uint32_t )];
+        char* const last  = escaped ? unescapeTo( s, s + n, first ) : first + n;
+        if( !escaped ) std::memcpy( first, s, n );
+        *last = '\0';
+
+        const uint32_t len = static_cast<uint32_t>( last - first );
+        std::memcpy( &strings[at], &len, sizeof( len ) );
+        strings.resize( at + sizeof( uint32_t ) + len + 1 ); // decoding may shrink the text
+        return at;
+    }
+
+    static const std::size_t MAX_KEYS = 4096;
+
+    std::vector<uint64_t>&                            tape;
+    std::vector<char>&                                strings;
+    std::vector<Open>                                 openNodes;
+    std::vector<std::size_t>                          keyAt; // key words of open objects
+    DuplicateKeys<uint64_t>                           duplicates;
+    std::unordered_map<StringView, uint64_t, KeyHash> keys; // key text -> offset
+};
+
+/**
+ * @brief Forwards parse events to a user JsonHandler. Numbers are converted
+ * and escaped strings decoded (into a reused scratch buffer) on the way.
+ */
+class Parser::SaxBuilder
+{
+public:
+    /// Thrown when the handler returns false; caught by Parser::parse
+    struct Stop {};
+
+    explicit SaxBuilder( JsonHandler& handler ) : handler( handler ) {}
+
+    void reserve( std::size_t ) {}
+
+    void beginObject( const char* ) { check( handler.startObject() ); }
+    void endObject  ( const char* ) { check( handler.endObject() );   }
+    void beginArray ( const char* ) { check( handler.startArray() );  }
+    void endArray   ( const char* ) { check( handler.endArray() );    }
+
+    void key   ( const char* s, std::size_t n, bool escaped ) { check( handler.key   ( text( s, n, escaped ) ) ); }
+    void string( const char* s, std::size_t n, bool escaped ) { check( handler.string( text( s, n, escaped ) ) ); }
+
+    void number( const char* s, std::size_t n, JsonType type )
+    {
+        int64_t i = 0;
+        if( type == JsonType::INT && parseInt64( s, n, i ) ) {
+            check( handler.integer( i ) );
+            return;
+        }
+        check( handler.number( parseDouble( s, n ) ) );
+    }
+
+    void boolean( bool v ) { check( handler.boolean( v ) ); }
+    void null()            { check( handler.null() ); }
+
+private:
+    static void check( bool keepGoing )
+    {
+        if( !keepGoing ) throw Stop();
+    }
+
+    StringView text( const char* s, std::size_t n, bool escaped )
+    {
+        if( !escaped )
+            return StringView( s, n );
+
+        this->scratch.resize( n );
+        char* const first = &this->scratch[0];
+        return StringView( first, unescapeTo( s, s + n, first ) - first );
+    }
+
+    JsonHandler& handler;
+    std::string  scratch;
+};
+
+/**
+ * @brief Text and container extents shared by every node of a lazy tree.
+ */
+struct Json::LazySource
+{
+    struct Extent
+    {
+        uint32_t begin; ///< offset of '{' or '['
+        uint32_t end;   ///< offset one past the matching '}' or ']'
+        uint32_t span;  ///< containers in this subtree, itself included
+    };
+
+    std::string         text;
+    std::vector<Extent> extents; // in document order (parents first)
+    mutable StringPool  keys;    // shared by every container built from `text`
+};
+
+/**
+ * @brief Validates the text and records the extent of every container;
+ * scalars are checked by the grammar but not stored.
+ */
+class Parser::LazyBuilder
+{
+public:
+    explicit LazyBuilder( Json::LazySource& src ) : src( src ) {}
+
+    void reserve( std::size_t ) {}
+
+    void beginObject( const char* at ) { open( at ); }
+    void endObject  ( const char* at ) { close( at ); }
+    void beginArray ( const char* at ) { open( at ); }
+    void endArray   ( const char* at ) { close( at ); }
+
+    void key    ( const char*, std::size_t, bool )     {}
+    void string ( const char*, std::size_t, bool )     {}
+    void number ( const char*, std::size_t, JsonType ) {}
+    void boolean( bool ) {}
+    void null()          {}
+
+private:
+    uint32_t offset( const char* at ) const
+    {
+        return static_cast<uint32_t>( at - this->src.text.data() );
+    }
+
+    void open( const char* at )
+    {
+        this->stack.push_back( static_cast<uint32_t>( this->src.extents.size() ) );
+        this->src.extents.push_back( { offset( at ), 0, 0 } );
+    }
+
+    void close( const char* at )
+    {
+        Json::LazySource::Extent& e = this->src.extents[this->stack.back()];
+        e.end  = offset( at ) + 1;
+        e.span = static_cast<uint32_t>( this->src.extents.size() - this->stack.back() );
+        this->stack.pop_back();
+    }
+
+    Json::LazySource&     src;
+    std::vector<uint32_t> stack;
+};
+
+// -----------------------------------------------------------------------------
+// Grammar (stage 2)
+// -----------------------------------------------------------------------------
+
+bool Parser::scanString( Cursor& cur, const char*& str, std::size_t& len, bool& escaped )
+{
+    const char* const start = cur.here() + 1; // skip opening '"'
+    const char*       p     = start;
+    escaped = false;
+
+    while( p < cur.end )
+    {
+        const unsigned char c = static_cast<unsigned char>( *p );
+
+        if( c == '"' ) {
+            str = start;
+            len = p - start;
+            ++cur.tok;
+            return true;
+        }
+        if( c == '\\' ) {
+            escaped = true;
+            if( ++p >= cur.end ) break;
+            switch( *p ) {
+                case '"': case '\\': case '/':
+                case 'b': case 'f': case 'n': case 'r': case 't':
+                    break;
+                case 'u':
+                    for( int k = 0; k < 4; ++k ) {
+                        if( ++p >= cur.end || !isxdigit( static_cast<unsigned char>( *p ) ) )
+                            return cur.fail( ParseError::InvalidUnicodeEscape );
+                    }
+                    break;
+                default:
+                    return cur.fail( ParseError::InvalidEscape );
+            }
+        }
+        else if( c < 0x20 ) {
+            return cur.fail( ParseError::ControlCharacter );
+        }
+        ++p;
+    }
+    return cur.fail( ParseError::UnterminatedString );
+}
+
+bool Parser::scanNumber( Cursor& cur, const char*& str, std::size_t& len, JsonType& type )
+{
+    ParseError  error = ParseError::None;
+    const char* start = cur.here();
+    const char* p     = matchNumber( start, cur.end, type, error );
+
+    if( !p )
+        return cur.fail( error );
+    if( p < cur.end && !isDelimiter( *p ) )
+        return cur.fail( ParseError::InvalidNumber );
+
+    str = start;
+    len = p - start;
+    ++cur.tok;
+    return true;
+}
+
+/**
+ * @brief Reports the scalar (string, number or literal) at the cursor.
+ */
+template <typename Builder>
+bool Parser::parseScalar( Cursor& cur, Builder& b )
+{
+    const char*  str = nullptr;
+    std::size_t  len = 0;
+
+    switch( cur.peek() )
+    {
+    case '"':
+    {
+        bool escaped = false;
+        if( !Parser::scanString( cur, str, len, escaped ) ) return false;
+        b.string( str, len, escaped );
+        break;
+    }
+    case 't':
+    case 'f':
+    case 'n':
+    {
+        const char* p = cur.here();
+        if     ( matchLiteral( p, cur.end, "true",  4 ) ) b.boolean( true );
+        else if( matchLiteral( p, cur.end, "false", 5 ) ) b.boolean( false );
+        else if( matchLiteral( p, cur.end, "null",  4 ) ) b.null();
+        else return cur.fail( ParseError::InvalidCharacter );
+        ++cur.tok;
+        break;
+    }
+    default:
+        if( cur.peek() == '-' || ( cur.peek() >= '0' && cur.peek() <= '9' ) ) {
+            JsonType type = JsonType::INT;
+            if( !Parser::scanNumber( cur, str, len, type ) ) return false;
+            b.number( str, len, type );
+        } else {
+            return cur.fail( ParseError::InvalidCharacter );
+        }
+        break;
+    }
+    return true;
+}
+
+/**
+ * @brief Reports an object key and consumes the ':' after it.
+ */
+template <typename Builder>
+bool Parser::parseKey( Cursor& cur, Builder& b )
+{
+    if( cur.atEnd() || cur.peek() != '"' )
+        return cur.fail( ParseError::ExpectedKey );
+
+    const char* key     = nullptr;
+    std::size_t len     = 0;
+    bool        escaped = false;
+    if( !Parser::scanString( cur, key, len, escaped ) ) return false;
+    b.key( key, len, escaped );
+
+    if( cur.atEnd() || cur.peek() != ':' )
+        return cur.fail( ParseError::ExpectedColon );
+    ++cur.tok;
+    return true;
+}
+
+/**
+ * @brief Parses one complete value. Nesting is tracked on `cur.stack`
+ * instead of the call stack, so thread stack use is constant and depth is
+ * bounded by `cur.maxDepth`.
+ * @return false with `cur.error` set if the input is malformed.
+ */
+template <typename Builder>
+bool Parser::parseValue( Cursor& cur, Builder& b )
+{
+    std::vector<char>& stack = cur.stack; // open containers: '{' or '['
+    stack.clear();
+
+    while( true )
+    {
+        // A value: containers are opened and their first member is read next
+        if( cur.atEnd() )
+            return cur.fail( ParseError::UnexpectedEnd );
+
+        const char c = cur.peek();
+        if( c == '{' || c == '[' )
+        {
+            if( stack.size() >= cur.maxDepth )
+                return cur.fail( ParseError::DepthExceeded );
+
+            const bool  isObj = ( c == '{' );
+            const char  close = isObj ? '}' : ']';
+            if( isObj ) b.beginObject( cur.here() );
+            else        b.beginArray ( cur.here() );
+            ++cur.tok;
+
+            if( cur.atEnd() || cur.peek() != close ) {
+                stack.push_back( c );
+                if( isObj && !Parser::parseKey( cur, b ) ) return false;
+                continue;
+            }
+            if( isObj ) b.endObject( cur.here() );
+            else        b.endArray ( cur.here() );
+            ++cur.tok;
+        }
+        else if( !Parser::parseScalar( cur, b ) )
+        {
+            return false;
+        }
+
+        // After a value: close finished containers, or move on to the next member
+        while( true )
+        {
+            if( stack.empty() )
+                return true;
+            if( cur.atEnd() )
+                return cur.fail( ParseError::MismatchedBrackets );
+
+            const bool isObj = ( stack.back() == '{' );
+            if( cur.peek() == ',' ) {
+                ++cur.tok;
+                if( isObj && !Parser::parseKey( cur, b ) ) return false;
+                break;
+            }
+            if( cur.peek() == ( isObj ? '}' : ']' ) ) {
+                if( isObj ) b.endObject( cur.here() );
+                else        b.endArray ( cur.here() );
+                ++cur.tok;
+                stack.pop_back();
+                continue;
+            }
+            return cur.fail( isObj ? ParseError::ExpectedObjectEnd : ParseError::ExpectedArrayEnd );
+        }
+    }
+}
+
+template <typename Builder>
+ParseResult Parser::parseDocument( const char* data, std::size_t length, Builder& b, const ParseOptions& options )
+{
+    if( length >= UINT32_MAX )
+        return parseFailure( ParseError::InputTooLarge, 0, data );
+
+    // Stage 1: one offset per structural byte at most (length + 1 covers
+    // the worst case); left uninitialized so untouched pages stay free.
+    std::unique_ptr<uint32_t[]> index( new uint32_t[length + 1] );
+    Utf8Validator utf8( reinterpret_cast<const unsigned char*>( data ), length );
+    const std::ptrdiff_t count = buildStructuralIndex( data, length, index.get(),
+                                                       options.validateUtf8 ? &utf8 : nullptr );
+    if( count == INDEX_BAD_UTF8 )
+        return parseFailure( ParseError::InvalidUtf8, firstInvalidUtf8( data, length ), data );
+    if( count < 0 )
+        return parseFailure( ParseError::UnterminatedString, length, data );
+
+    // Stage 2: blank input is reported as a single null
+    b.reserve( static_cast<std::size_t>( count ) );
+    Cursor cur( data, length, index.get(), static_cast<std::size_t>( count ) );
+    cur.maxDepth = options.maxDepth;
+    if( cur.atEnd() ) {
+        b.null();
+        return ParseResult();
+    }
+
+    if( Parser::parseValue( cur, b ) && !cur.atEnd() )
+        cur.fail( ParseError::TrailingCharacters );
+
+    if( cur.error != ParseError::None )
+        return parseFailure( cur.error, cur.errorAt, data );
+    return ParseResult();
+}
+
+/**
+ * @brief Parses `count` comma-separated values (a slice of an array's
+ * elements, without brackets) into out[0 .. count).
+ * @throws TinyJsonException (without the "Parse Error: " prefix).
+ */
+void Parser::parseElements( const char* data, std::size_t length, std::size_t base, Json* out, std::size_t count,
+                            const ParseOptions& options )
+{
+    if( length >= UINT32_MAX )
+        throw TinyJsonException( "Array element larger than 4 GiB is not supported" );
+
+    std::unique_ptr<uint32_t[]> index( new uint32_t[length + 1] );
+    Utf8Validator utf8( reinterpret_cast<const unsigned char*>( data ), length );
+    const std::ptrdiff_t n = buildStructuralIndex( data, length, index.get(),
+                                                   options.validateUtf8 ? &utf8 : nullptr );
+    if( n == INDEX_BAD_UTF8 )
+        throw TinyJsonException( describeError( ParseResult{ ParseError::InvalidUtf8, base + firstInvalidUtf8( data, length ) } ) );
+    if( n < 0 )
+        throw TinyJsonException( describeError( ParseResult{ ParseError::UnterminatedString, base + length } ) );
+
+    Cursor cur( data, length, index.get(), static_cast<std::size_t>( n ) );
+    cur.base     = base;
+    cur.maxDepth = options.maxDepth - 1; // inside the root array (parseParallel handles 0)
+
+    KeyCache keys( options ); // shared by the chunk's elements
+    bool     ok = true;
+    for( std::size_t i = 0; ok && i < count; ++i )
+    {
+        if( i > 0 ) {
+            if( cur.atEnd() || cur.peek() != ',' ) {
+                ok = cur.fail( ParseError::ExpectedArrayEnd );
+                break;
+            }
+            ++cur.tok;
+        }
+        DomBuilder builder( out[i], keys );
+        ok = Parser::parseValue( cur, builder );
+    }
+
+    if( ok && !cur.atEnd() )
+        cur.fail( ParseError::ExpectedArrayEnd );
+    if( cur.error != ParseError::None )
+        throw TinyJsonException( describeError( ParseResult{ cur.error, cur.errorAt } ) );
+}
+
+Json Parser::parse( const char* str )
+{
+    return Parser::parse( str, std::strlen( str ) );
+}
+
+Json Parser::parse( const std::string& str )
+{
+    return Parser::parse( str.data(), str.size() );
+}
+
+Json Parser::parse( const char* data, std::size_t length )
+{
+    return Parser::parse( StringView( data, length ), ParseOptions() );
+}
+
+Json Parser::parse( StringView text, const ParseOptions& options )
+{
+    Json              root( JsonType::UNKNOWN );
+    KeyCache          keys( options );
+    DomBuilder        builder( root, keys );
+    const ParseResult result = Parser::parseDocument( text.data(), text.size(), builder, options );
+    if( !result )
+        throwParseError( result );
+    return root;
+}
+
+ParseResult Parser::tryParse( StringView text, Json& out, const ParseOptions& options ) noexcept
+{
+    try {
+        Json              root( JsonType::UNKNOWN );
+        KeyCache          keys( options );
+        DomBuilder        builder( root, keys );
+        const ParseResult result = Parser::parseDocument( text.data(), text.size(), builder, options );
+        if( result )
+            out = std::move( root );
+        return result;
+    }
+    catch( const std::bad_alloc& ) { // the only exception a DomBuilder raises
+        return ParseResult{ ParseError::OutOfMemory };
+    }
+}
+
+bool Parser::parse( const std::string& str, JsonHandler& handler, const ParseOptions& options )
+{
+    return Parser::parse( str.data(), str.size(), handler, options );
+}
+
+bool Parser::parse( const char* data, std::size_t length, JsonHandler& handler, const ParseOptions& options )
+{
+    ParseResult result;
+    try {
+        SaxBuilder builder( handler );
+        result = Parser::parseDocument( data, length, builder, options );
+    }
+    catch( const SaxBuilder::Stop& ) {
+        return false;
+    }
+    // Anything the handler throws reaches the caller unchanged
+
+    if( !result )
+        throwParseError( result );
+    return true;
+}
+
+ViewDocument Parser::parseInSitu( char* buffer, std::size_t length, const ParseOptions& options )
+{
+    ViewDocument      doc;
+    ViewBuilder       builder( doc, buffer );
+    const ParseResult result = Parser::parseDocument( buffer, length, builder, options );
+    if( !result )
+        throwParseError( result );
+    return doc;
+}
+
+TapeDocument Parser::parseTape( StringView text, const ParseOptions& options )
+{
+    TapeDocument      doc;
+    const ParseResult result = Parser::tryParse( text, doc, options );
+    if( result.error == ParseError::OutOfMemory )
+        throw std::bad_alloc();
+    if( !result )
+        throwParseError( result );
+    return doc;
+}
+
+ParseResult Parser::tryParse( StringView text, TapeDocument& out, const ParseOptions& options ) noexcept
+{
+    try {
+        TapeDocument      doc;
+        TapeBuilder       builder( doc );
+        const ParseResult result = Parser::parseDocument( text.data(), text.size(), builder, options );
+        if( result ) {
+            builder.finish();
+            out = std::move( doc );
+        }
+        return result;
+    }
+    catch( const TapeBuilder::TooLarge& ) {
+        return ParseResult{ ParseError::DocumentTooLarge };
+    }
+    catch( const std::bad_alloc& ) {
+        return ParseResult{ ParseError::OutOfMemory };
+    }
+}
+
+Json Parser::parseLazy( const char* data, std::size_t length, const ParseOptions& options )
+{
+    return Parser::parseLazy( std::string( data, length ), options );
+}
+
+Json Parser::parseLazy( std::string text, const ParseOptions& options )
+{
+    std::shared_ptr<Json::LazySource> src = std::make_shared<Json::LazySource>();
+    src->text = std::move( text );
+
+    LazyBuilder       builder( *src );
+    const ParseResult result = Parser::parseDocument( src->text.data(), src->text.size(), builder, options );
+    if( !result )
+        throwParseError( result );
+
+    // A scalar root has nothing to defer
+    if( src->extents.empty() )
+        return Parser::parse( src->text, options );
+
+    Json root( src->text[src->extents[0].begin] == '{' ? JsonType::OBJECT : JsonType::ARRAY );
+    root.val.box->lazySrc  = std::move( src );
+    root.val.box->lazyNode = 0;
+    return root;
+}
+
+// -----------------------------------------------------------------------------
+// File Source
+// -----------------------------------------------------------------------------
+
+namespace {
+
+/**
+ * @brief Read-only bytes of a whole file. Regular files are memory-mapped
+ * with sequential read-ahead hints; anything else (pipes, empty or special
+ * files, non-POSIX platforms) is read into one pre-sized buffer.
+ */
+class FileSource
+{
+public:
+    explicit FileSource( const std::string& fileName )
+    {
+#if TINYJSON_HAS_MMAP
+        const int fd = ::open( fileName.c_str(), O_RDONLY | O_CLOEXEC );
+        if( fd < 0 )
+            throw TinyJsonException( "File open failed: " + fileName );
+
+        struct stat st;
+        const bool regular = ::fstat( fd, &st ) == 0 && S_ISREG( st.st_mode );
+
+        if( regular && st.st_size > 0 )
+        {
+            const std::size_t size = static_cast<std::size_t>( st.st_size );
+            void* map = ::mmap( nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0 );
+            if( map != MAP_FAILED )
+            {
+                // The parser reads front to back, twice (index, then tree)
+                ::madvise( map, size, MADV_SEQUENTIAL );
+                ::madvise( map, size, MADV_WILLNEED );
+
+                this->ptr    = static_cast<const char*>( map );
+                this->len    = size;
+                this->mapped = true;
+                ::close( fd );
+                return;
+            }
+        }
+
+        // Fallback: a single read when the size is known, chunks otherwise
+        this->buffer.resize( regular && st.st_size > 0 ? static_cast<std::size_t>( st.st_size ) : 64 * 1024 );
+        std::size_t used = 0;
+        while( true )
+        {
+            if( used == this->buffer.size() )
+                this->buffer.resize( this->buffer.size() * 2 );
+
+            const ssize_t n = ::read( fd, &this->buffer[used], this->buffer.size() - used );
+            if( n < 0 ) {
+                ::close( fd );
+                throw TinyJsonException( "File read failed: " + fileName );
+            }
+            if( n == 0 ) break;
+            used += static_cast<std::size_t>( n );
+        }
+        ::close( fd );
+        this->buffer.resize( used );
+#else
+        std::ifstream ifs( fileName, std::ios::binary | std::ios::ate );
+        if( !ifs.is_open() )
+            throw TinyJsonException( "File open failed: " + fileName );
+
+        const std::streamoff size = ifs.tellg();
+        ifs.seekg( 0 );
+        this->buffer.resize( size > 0 ? static_cast<std::size_t>( size ) : 0 );
+        if( size > 0 && !ifs.read( &this->buffer[0], size ) )
+            throw TinyJsonException( "File read failed: " + fileName );
+#endif
+        this->ptr = this->buffer.data();
+        this->len = this->buffer.size();
+    }
+
+    ~FileSource()
+    {
+#if TINYJSON_HAS_MMAP
+        if( this->mapped )
+            ::munmap( const_cast<char*>( this->ptr ), this->len );
+#endif
+    }
+
+    FileSource( const FileSource& )            = delete;
+    FileSource& operator=( const FileSource& ) = delete;
+
+    const char* data() const noexcept { return this->ptr; }
+    std::size_t size() const noexcept { return this->len; }
+
+private:
+    const char* ptr    = nullptr;
+    std::size_t len    = 0;
+    bool        mapped = false;
+    std::string buffer;
+};
+
+} // namespace
+
+Json Parser::parseFile( const std::string& fileName )
+{
+    return Parser::parseFile( fileName, ParseOptions() );
+}
+
+Json Parser::parseFile( const std::string& fileName, const ParseOptions& options )
+{
+    FileSource src( fileName );
+    return Parser::parse( StringView( src.data(), src.size() ), options );
+}
+
+// -----------------------------------------------------------------------------
+// JSON Lines (Parallel)
+// -----------------------------------------------------------------------------
+
+namespace {
+
+/// Worker count for a `threads` argument (0 = one per hardware thread)
+unsigned resolveThreads( unsigned threads ) noexcept
+{
+    if( threads == 0 ) threads = std::thread::hardware_concurrency();
+    return threads == 0 ? 1 : threads;
+}
+
+/// Upper bound of a batch; streams are read in blocks of this size
+const std::size_t LINE_BATCH_BYTES = 1 << 20;
+
+/// Lower bound of a batch cut from an in-memory buffer
+const std::size_t LINE_BATCH_MIN_BYTES = 16 * 1024;
+
+/**
+ * @brief A run of whole lines, parsed by one worker. Stream input keeps
+ * its bytes in `owned`; buffer input points into the caller's memory.
+ */
+struct LineBatch
+{
+    std::string        owned;
+    const char*        first = nullptr;
+    const char*        last  = nullptr;
+
+    std::vector<Json>  values;
+    std::size_t        lines     = 0; // newlines in [first, last)
+    std::size_t        errorLine = 0; // 1-based, within this batch
+    std::exception_ptr error;
+    bool               done      = false;
+};
+
+/**
+ * @brief Parses every non-blank line of a batch. Stops at the first error,
+ * remembering the line it occurred on.
+ */
+void parseLineBatch( LineBatch& batch, const ParseOptions& options )
+{
+    const char* p = batch.first;
+    while( p < batch.last )
+    {
+        const char* eol  = static_cast<const char*>( std::memchr( p, '\n', batch.last - p ) );
+        const char* next = eol ? eol + 1 : batch.last;
+        if( !eol ) eol = batch.last;
+        ++batch.lines;
+
+        const char* q = p;
+        while( q < eol && ( *q == ' ' || *q == '\t' || *q == '\r' ) ) ++q;
+
+        if( q < eol )
+        {
+            try {
+                batch.values.push_back( Parser::parse( StringView( p, eol - p ), options ) );
+            }
+            catch( ... ) {
+                batch.error     = std::current_exception();
+                batch.errorLine = batch.lines;
+                return;
+            }
+        }
+        p = next;
+    }
+}
+
+/**
+ * @brief Fixed pool of workers fed by the calling thread. Batches are
+ * parsed in any order but handed to `sink` strictly in submission order;
+ * at most `window` batches are alive at a time.
+ */
+class LinePipeline
+{
+public:
+    LinePipeline( unsigned threads, const Parser::RecordCallback& sink, const ParseOptions& options )
+        : sink( sink ), options( options )
+    {
+        threads = resolveThreads( threads );
+
+        this->window = threads * 2;
+        this->workers.reserve( threads );
+        try {
+            for( unsigned i = 0; i < threads; ++i )
+                this->workers.emplace_back( [this]() { this->work(); } );
+        }
+        catch( ... ) { // no destructor runs: release the started workers here
+            this->stop();
+            throw;
+        }
+    }
+
+    ~LinePipeline()
+    {
+        this->stop();
+    }
+
+    LinePipeline( const LinePipeline& )            = delete;
+    LinePipeline& operator=( const LinePipeline& ) = delete;
+
+    /// Queues a batch, then delivers finished ones while the window is full
+    void submit( std::unique_ptr<LineBatch> batch )
+    {
+        if( batch->first == batch->last ) return;
+        {
+            std::lock_guard<std::mutex> lock( this->mutex );
+            this->pending.push_back( batch.get() );
+            this->inFlight.push_back( std::move( batch ) );
+        }
+        this->workCv.notify_one();
+
+        while( this->inFlight.size() >= this->window )
+            this->deliverFront();
+    }
+
+    std::size_t threadCount() const noexcept { return this->workers.size(); }
+
+    /// Delivers everything still in flight
+    void finish()
+    {
+        while( !this->inFlight.empty() )
+            this->deliverFront();
+    }
+
+private:
+    /// Stops and joins the workers, abandoning anything not yet parsed
+    void stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock( this->mutex );
+            this->pending.clear(); // abandoned on error: skip the rest
+            this->stopping = true;
+        }
+        this->workCv.notify_all();
+        for( auto& t : this->workers ) t.join();
+    }
+
+    void work()
+    {
+        while( true )
+        {
+            LineBatch* batch = nullptr;
+            {
+                std::unique_lock<std::mutex> lock( this->mutex );
+                this->workCv.wait( lock, [this]() { return this->stopping || !this->pending.empty(); } );
+                if( this->pending.empty() ) return;
+                batch = this->pending.front();
+                this->pending.pop_front();
+            }
+
+            parseLineBatch( *batch, this->options );
+
+            {
+                std::lock_guard<std::mutex> lock( this->mutex );
+                batch->done = true;
+            }
+            this->doneCv.notify_all();
+        }
+    }
+
+    void deliverFront()
+    {
+        std::unique_ptr<LineBatch> batch;
+        {
+            std::unique_lock<std::mutex> lock( this->mutex );
+            this->doneCv.wait( lock, [this]() { return this->inFlight.front()->done; } );
+            batch = std::move( this->inFlight.front() );
+            this->inFlight.pop_front();
+        }
+
+        // Values before the failing line are still delivered
+        for( auto& v : batch->values )
+            this->sink( std::move( v ) );
+
+        if( batch->error )
+        {
+            const std::string line = std::to_string( this->linesDone + batch->errorLine );
+            try {
+                std::rethrow_exception( batch->error );
+            }
+            catch( const std::exception& e ) {
+                throw TinyJsonException( "Line " + line + ": " + e.what() );
+            }
+        }
+        this->linesDone += batch->lines;
+    }
+
+    const Parser::RecordCallback& sink;
+    const ParseOptions&           options;
+    std::size_t                   window    = 1;
+    std::size_t                   linesDone = 0;
+
+    std::vector<std::thread>      workers;
+    std::mutex                    mutex;
+    std::condition_variable       workCv;
+    std::condition_variable       doneCv;
+    std::deque<LineBatch*>        pending;  // waiting for a worker
+    std::deque<std::unique_ptr<LineBatch>> inFlight; // submission order
+    bool                          stopping  = false;
+};
+
+/**
+ * @brief Cuts an in-memory buffer into line-aligned batches. Records never
+ * span lines (JSON strings cannot contain a raw newline), so a cut just
+ * after any '\n' is safe.
+ */
+void runLines( const char* data, std::size_t length, const Parser::RecordCallback& sink, unsigned threads,
+               const ParseOptions& options )
+{
+    LinePipeline pipeline( threads, sink, options );
+
+    const std::size_t perThread = length / ( pipeline.threadCount() * 4 );
+    const std::size_t target    = std::min( LINE_BATCH_BYTES, std::max( LINE_BATCH_MIN_BYTES, perThread ) );
+
+    const char* p   = data;
+    const char* end = data + length;
+    while( p < end )
+    {
+        const char* cut = p + std::min<std::size_t>( target, end - p );
+        if( cut < end ) {
+            const char* eol = static_cast<const char*>( std::memchr( cut, '\n', end - cut ) );
+            cut = eol ? eol + 1 : end;
+        }
+
+        std::unique_ptr<LineBatch> batch( new LineBatch() );
+        batch->first = p;
+        batch->last  = cut;
+        pipeline.submit( std::move( batch ) );
+        p = cut;
+    }
+    pipeline.finish();
+}
+
+/**
+ * @brief Reads a stream block by block; the partial line at the end of a
+ * block is carried over into the next batch.
+ */
+void runLines( std::istream& in, const Parser::RecordCallback& sink, unsigned threads, const ParseOptions& options )
+{
+    LinePipeline pipeline( threads, sink, options );
+
+    std::string carry;
+    bool eof = false;
+    while( !eof )
+    {
+        std::unique_ptr<LineBatch> batch( new LineBatch() );
+        std::string& text = batch->owned;
+        text.swap( carry );
+
+        const std::size_t used = text.size();
+        text.resize( used + LINE_BATCH_BYTES );
+        in.read( &text[used], LINE_BATCH_BYTES );
+        text.resize( used + static_cast<std::size_t>( in.gcount() ) );
+        eof = !in;
+
+        if( !eof ) {
+            const std::size_t eol = text.rfind( '\n' );
+            if( eol == std::string::npos ) { // one very long line: keep reading
+                carry.swap( text );
+                continue;
+            }
+            carry.assign( text, eol + 1, std::string::npos );
+            text.resize( eol + 1 );
+        }
+
+        batch->first = text.data();
+        batch->last  = text.data() + text.size();
+        pipeline.submit( std::move( batch ) );
+    }
+    pipeline.finish();
+}
+
+} // namespace
+
+void Parser::parseLines( StringView text, const RecordCallback& onRecord, unsigned threads,
+                         const ParseOptions& options )
+{
+    runLines( text.data(), text.size(), onRecord, threads, options );
+}
+
+void Parser::parseLines( std::istream& in, const RecordCallback& onRecord, unsigned threads,
+                         const ParseOptions& options )
+{
+    runLines( in, onRecord, threads, options );
+}
+
+void Parser::parseLinesFile( const std::string& fileName, const RecordCallback& onRecord, unsigned threads,
+                             const ParseOptions& options )
+{
+    FileSource src( fileName );
+    runLines( src.data(), src.size(), onRecord, threads, options );
+}
+
+std::vector<Json> Parser::parseLines( StringView text, unsigned threads, const ParseOptions& options )
+{
+    std::vector<Json> out;
+    Parser::parseLines( text, [&out]( Json&& v ) { out.push_back( std::move( v ) ); }, threads, options );
+    return out;
+}
+
+std::vector<Json> Parser::parseLines( std::istream& in, unsigned threads, const ParseOptions& options )
+{
+    std::vector<Json> out;
+    Parser::parseLines( in, [&out]( Json&& v ) { out.push_back( std::move( v ) ); }, threads, options );
+    return out;
+}
+
+std::vector<Json> Parser::parseLinesFile( const std::string& fileName, unsigned threads, const ParseOptions& options )
+{
+    std::vector<Json> out;
+    Parser::parseLinesFile( fileName, [&out]( Json&& v ) { out.push_back( std::move( v ) ); }, threads, options );
+    return out;
+}
+
+// -----------------------------------------------------------------------------
+// Top-Level Array (Parallel)
+// -----------------------------------------------------------------------------
+
+namespace {
+
+/// Inputs below this size are not worth splitting
+const std::size_t PARALLEL_MIN_BYTES = 1 << 20;
+
+/// Upper bound of one chunk's text
+const std::size_t PARALLEL_MAX_CHUNK = 64u << 20;
+
+/**
+ * @brief Element boundaries of a top-level array. Chunk k covers elements
+ * [firstElem[k], firstElem[k+1]) whose text lies between cut[k] and cut[k+1]
+ * (exclusive: each cut is the '[' , a top-level ',' or the ']').
+ */
+struct ArraySplit
+{
+    std::vector<std::size_t> cut;
+    std::vector<std::size_t> firstElem;
+};
+
+/**
+ * @brief Finds top-level commas with the stage-1 classifier, cutting
+ * roughly every `chunkBytes`. Only the bracket depth is tracked; the
+ * chunks themselves are validated when they are parsed.
+ * @return false if the root is not an array or the brackets do not balance
+ * (the caller then falls back to Parser::parse for the error report).
+ */
+bool splitTopLevelArray( const char* data, std::size_t length, std::size_t chunkBytes, ArraySplit& split )
+{
+    const unsigned char* in = reinterpret_cast<const unsigned char*>( data );
+
+    std::size_t p = 0;
+    while( p < length && isJsonSpace( data[p] ) ) ++p;
+    if( p == length || in[p] != '[' )
+        return false;
+
+    split.cut.push_back( p );
+    split.firstElem.push_back( 0 );
+
+    std::size_t commas     = 0;
+    std::size_t nextTarget = p + chunkBytes;
+    std::size_t close      = 0;
+    long long   depth      = 0;
+
+    uint64_t escapeCarry = 0;
+    uint64_t inString    = 0;
+
+    unsigned char tail[BLOCK_SIZE];
+    BlockMasks    m;
+
+    for( std::size_t base = p - p % BLOCK_SIZE; base < length && close == 0; base += BLOCK_SIZE )
+    {
+        const unsigned char* block = in + base;
+        if( length - base < BLOCK_SIZE ) {
+            std::memset( tail, ' ', BLOCK_SIZE );
+            std::memcpy( tail, block, length - base );
+            block = tail;
+        }
+        classifyBlock( block, m );
+
+        const uint64_t escaped = ( m.backslash | escapeCarry ) ? findEscaped( m.backslash, escapeCarry ) : 0;
+        const uint64_t strings = prefixXor( m.quote & ~escaped ) ^ inString;
+        inString = uint64_t( int64_t( strings ) >> 63 );
+
+        uint64_t ops = m.op & ~strings;
+        if( base < p )
+            ops &= ~uint64_t( 0 ) << ( p - base ); // bytes before the root
+
+        while( ops )
+        {
+            const std::size_t at = base + countTrailingZeros( ops );
+            ops &= ops - 1;
+
+            switch( block[at - base] ) {
+            case '[': case '{':
+                ++depth;
+                break;
+            case ']': case '}':
+                if( --depth == 0 ) { close = at; ops = 0; }
+                break;
+            case ',':
+                if( depth == 1 ) {
+                    ++commas;
+                    if( at >= nextTarget ) {
+                        split.cut.push_back( at );
+                        split.firstElem.push_back( commas );
+                        nextTarget = at + chunkBytes;
+                    }
+                }
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    if( close == 0 || in[close] != ']' )
+        return false;
+    for( std::size_t q = close + 1; q < length; ++q ) {
+        if( !isJsonSpace( data[q] ) ) return false;
+    }
+
+    split.cut.push_back( close );
+    split.firstElem.push_back( commas + 1 );
+    return true;
+}
+
+} // namespace
+
+Json Parser::parseParallel( StringView text, unsigned threads, const ParseOptions& options )
+{
+    threads = resolveThreads( threads );
+    const char* const data   = text.data();
+    const std::size_t length = text.size();
+
+    const std::size_t chunkBytes = std::min( PARALLEL_MAX_CHUNK,
+                                             std::max( PARALLEL_MIN_BYTES / 4, length / ( threads * 8 ) ) );
+
+    ArraySplit split;
+    if( threads == 1 || length < PARALLEL_MIN_BYTES || !splitTopLevelArray( data, length, chunkBytes, split ) )
+        return Parser::parse( text, options );
+
+    // "[ ]" has one empty chunk; it still needs the strict grammar
+    const std::size_t total = split.firstElem.back();
+    if( total == 1 && std::all_of( data + split.cut[0] + 1, data + split.cut[1], isJsonSpace ) )
+        return Parser::parse( text, options );
+    if( options.maxDepth == 0 ) // the root array itself is too deep
+        return Parser::parse( text, options );
+
+    Json root( JsonType::ARRAY );
+    JsonArrays& elements = root.val.box->arr;
+    elements.reserve( total );
+    for( std::size_t i = 0; i < total; ++i )
+        elements.emplace_back( JsonType::UNKNOWN );
+
+    const std::size_t chunks = split.cut.size() - 1;
+    std::vector<std::exception_ptr> errors( chunks );
+    std::size_t nextChunk = 0;
+    std::mutex  mutex;
+
+    auto work = [&]() {
+        while( true )
+        {
+            std::size_t k;
+            {
+                std::lock_guard<std::mutex> lock( mutex );
+                if( nextChunk == chunks ) return;
+                k = nextChunk++;
+            }
+            const std::size_t from = split.cut[k] + 1;
+            try {
+                Parser::parseElements( data + from, split.cut[k + 1] - from, from,
+                                       &elements[split.firstElem[k]],
+                                       split.firstElem[k + 1] - split.firstElem[k], options );
+            }
+            catch( ... ) {
+                errors[k] = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve( threads );
+    for( unsigned i = 1; i < std::min<std::size_t>( threads, chunks ); ++i ) {
+        try {
+            workers.emplace_back( work );
+        }
+        catch( const std::system_error& ) {
+            break; // out of threads: the started ones and this one share the chunks
+        }
+    }
+    work(); // the calling thread takes chunks as well
+    for( auto& t : workers ) t.join();
+
+    // Report the first error in document order
+    for( auto& e : errors )
+    {
+        if( !e ) continue;
+        try {
+            std::rethrow_exception( e );
+        }
+        catch( const std::exception& ex ) {
+            throw TinyJsonException( std::string( "Parse Error: " ) + ex.what() );
+        }
+    }
+    return root;
+}
+
+Json Parser::parseFileParallel( const std::string& fileName, unsigned threads, const ParseOptions& options )
+{
+    FileSource src( fileName );
+    return Parser::parseParallel( StringView( src.data(), src.size() ), threads, options );
+}
+
+// =============================================================================
+// [StreamParser Implementation]
+// =============================================================================
+
+/**
+ * @brief Resumable parser state. `mode` says what the next byte may be;
+ * strings, numbers and literals that cross a chunk boundary are collected
+ * in `token` until they end. Values are built with the same DomBuilder
+ * used by Parser::parse.
+ */
+struct StreamParser::State
+{
+    enum class Mode {
+        Value,           ///< a value (or, at top level, whitespace)
+        ValueOrArrayEnd, ///< right after '['
+        KeyOrObjectEnd,  ///< right after '{'
+        Key,             ///< after ',' in an object
+        Colon,           ///< after a key
+        CommaOrEnd,      ///< after a value inside a container
+        String,
+        Number,
+        Literal
+    };
+
+    State( Callback cb, const ParseOptions& options )
+        : onValue( std::move( cb ) ), options( options ), root( JsonType::UNKNOWN ), keys( options )
+        , builder( root, keys )
+    {}
+
+    Callback                 onValue;
+    std::deque<Json>         ready;
+    const ParseOptions       options;   ///< kept for reset()
+
+    Json                     root;
+    Parser::KeyCache         keys;
+    Parser::DomBuilder       builder;
+    std::vector<char>        stack;     ///< open containers: '{' or '['
+
+    Mode                     mode       = Mode::Value;
+    bool                     isKey      = false;
+    bool                     escaped    = false; ///< current string has escapes
+    int                      escape     = 0;     ///< 1 after '\\', 2..5 inside \uXXXX
+    std::string              token;
+
+    std::size_t              offset     = 0;     ///< bytes consumed by earlier chunks
+    bool                     failed     = false;
+
+    [[noreturn]] void fail( const char* what, std::size_t at )
+    {
+        this->failed = true;
+        throw TinyJsonException( std::string( "Parse Error: " ) + what
+                               + " (at offset " + std::to_string( at ) + ")" );
+    }
+
+    void valueDone()
+    {
+        if( !this->stack.empty() ) {
+            this->mode = Mode::CommaOrEnd;
+            return;
+        }
+
+        this->mode = Mode::Value;
+        if( this->onValue ) this->onValue( std::move( this->root ) );
+        else                this->ready.push_back( std::move( this->root ) );
+        this->root = Json( JsonType::UNKNOWN );
+    }
+
+    void open( char c )
+    {
+        this->stack.push_back( c );
+        if( c == '{' ) { this->builder.beginObject(); this->mode = Mode::KeyOrObjectEnd;  }
+        else           { this->builder.beginArray();  this->mode = Mode::ValueOrArrayEnd; }
+    }
+
+    void close()
+    {
+        if( this->stack.back() == '{' ) this->builder.endObject();
+        else                            this->builder.endArray();
+        this->stack.pop_back();
+        this->valueDone();
+    }
+
+    void startToken( Mode m, bool key = false )
+    {
+        this->mode    = m;
+        this->isKey   = key;
+        this->escaped = false;
+        this->escape  = 0;
+        this->token.clear();
+    }
+
+    void startValue( char c, std::size_t at )
+    {
+        if( ( c == '{' || c == '[' ) && this->stack.size() >= this->options.maxDepth )
+            this->fail( "Maximum nesting depth exceeded", at );
+
+        if( c == '{' || c == '[' )                  this->open( c );
+        else if( c == '"' )                         this->startToken( Mode::String );
+        else if( c == '-' || ( c >= '0' && c <= '9' ) ) this->startToken( Mode::Number );
+        else if( c == 't' || c == 'f' || c == 'n' ) this->startToken( Mode::Literal );
+        else this->fail( "Invalid character in JSON", at );
+    }
+
+    /** @brief Completes a string; `at` is the offset just past its closing quote. */
+    void endString( std::size_t at )
+    {
+        // The token holds the raw bytes between the quotes (escapes are
+        // ASCII), so it can be checked on its own
+        if( this->options.validateUtf8 ) {
+            const std::size_t bad = firstInvalidUtf8( this->token.data(), this->token.size() );
+            if( bad != this->token.size() )
+                this->fail( ParseResult{ ParseError::InvalidUtf8 }.message(), at - 1 - this->token.size() + bad );
+        }
+
+        if( this->isKey ) {
+            this->builder.key( this->token.data(), this->token.size(), this->escaped );
+            this->mode = Mode::Colon;
+        } else {
+            this->builder.string( this->token.data(), this->token.size(), this->escaped );
+            this->valueDone();
+        }
+    }
+
+    /**
+     * @brief Completes a number or literal. `next` is the byte after it
+     * (nullptr at end of input), which must be a delimiter.
+     */
+    void endAtom( const char* next, std::size_t at )
+    {
+        if( next && !isDelimiter( *next ) )
+            this->fail( this->mode == Mode::Number ? "Invalid number" : "Invalid character in JSON", at );
+
+        const char* first = this->token.data();
+        const char* last  = first + this->token.size();
+
+        if( this->mode == Mode::Number )
+        {
+            JsonType   type  = JsonType::INT;
+            ParseError error = ParseError::InvalidNumber;
+            if( matchNumber( first, last, type, error ) != last )
+                this->fail( ParseResult{ error }.message(), at );
+            this->builder.number( first, this->token.size(), type );
+        }
+        else
+        {
+            if     ( this->token == "true"  ) this->builder.boolean( true );
+            else if( this->token == "false" ) this->builder.boolean( false );
+            else if( this->token == "null"  ) this->builder.null();
+            else this->fail( "Invalid character in JSON", at );
+        }
+        this->valueDone();
+    }
+};
+
+StreamParser::StreamParser()
+    : state( new State( Callback(), ParseOptions() ) )
+{
+}
+
+StreamParser::StreamParser( const ParseOptions& options )
+    : state( new State( Callback(), options ) )
+{
+}
+
+StreamParser::StreamParser( Callback onValue, const ParseOptions& options )
+    : state( new State( std::move( onValue ), options ) )
+{
+}
+
+StreamParser::~StreamParser() = default;
+StreamParser::StreamParser( StreamParser&& other ) noexcept = default;
+StreamParser& StreamParser::operator=( StreamParser&& other ) noexcept = default;
+
+// A moved-from parser has no state until reset()
+StreamParser::State& StreamParser::checkedState() const
+{
+    if( !this->state )
+        throw TinyJsonException( "StreamParser is in a failed state" );
+    return *this->state;
+}
+
+void StreamParser::feed( const std::string& chunk )
+{
+    this->feed( chunk.data(), chunk.size() );
+}
+
+void StreamParser::feed( const char* data, std::size_t length )
+{
+    using Mode = State::Mode;
+    State& st = this->checkedState();
+
+    if( st.failed )
+        throw TinyJsonException( "StreamParser is in a failed state; call reset()" );
+
+    const char*       p   = data;
+    const char* const end = data + length;
+    auto at = [&]() { return st.offset + static_cast<std::size_t>( p - data ); };
+
+    while( p < end )
+    {
+        switch( st.mode )
+        {
+        case Mode::String:
+        {
+            if( st.escape == 1 ) {
+                switch( *p ) {
+                    case '"': case '\\': case '/':
+                    case 'b': case 'f': case 'n': case 'r': case 't':
+                        st.escape = 0; break;
+                    case 'u':
+                        st.escape = 2; break;
+                    default:
+                        st.fail( "Invalid escape sequence in string", at() );
+                }
+                st.token += *p++;
+                break;
+            }
+            if( st.escape >= 2 ) {
+                if( !isxdigit( static_cast<unsigned char>( *p ) ) )
+                    st.fail( "Invalid \\u escape in string", at() );
+                st.escape = ( st.escape == 5 ) ? 0 : st.escape + 1;
+                st.token += *p++;
+                break;
+            }
+
+            // Copy the plain run up to the next quote, backslash or control byte
+            const char* run = p;
+            while( p < end && *p != '"' && *p != '\\' && static_cast<unsigned char>( *p ) >= 0x20 ) ++p;
+            st.token.append( run, p - run );
+            if( p == end ) break;
+
+            if( *p == '"' ) {
+                ++p;
+                st.endString( at() );
+            } else if( *p == '\\' ) {
+                st.token += *p++;
+                st.escaped = true;
+                st.escape  = 1;
+            } else {
+                st.fail( "Unescaped control character in string", at() );
+            }
+            break;
+        }
+
+        case Mode::Number:
+        case Mode::Literal:
+        {
+            const char* run = p;
+            if( st.mode == Mode::Number )
+                while( p < end && ( ( *p >= '0' && *p <= '9' ) || *p == '-' || *p == '+' || *p == '.' || *p == 'e' || *p == 'E' ) ) ++p;
+            else
+                while( p < end && *p >= 'a' && *p <= 'z' ) ++p;
+            st.token.append( run, p - run );
+
+            if( p < end )
+                st.endAtom( p, at() ); // the delimiter is handled next round
+            break;
+        }
+
+        default:
+        {
+            const char c = *p;
+            if( c == ' ' || c == '\t' || c == '\n' || c == '\r' ) {
+                ++p;
+                break;
+            }
+
+            switch( st.mode )
+            {
+            case Mode::ValueOrArrayEnd:
+                if( c == ']' ) { ++p; st.close(); break; }
+                // fall through
+            case Mode::Value:
+                st.startValue( c, at() );
+                if( st.mode != Mode::Number && st.mode != Mode::Literal ) ++p;
+                break;
+
+            case Mode::KeyOrObjectEnd:
+                if( c == '}' ) { ++p; st.close(); break; }
+                // fall through
+            case Mode::Key:
+                if( c != '"' ) st.fail( "Expected string key in object", at() );
+                ++p;
+                st.startToken( Mode::String, true );
+                break;
+
+            case Mode::Colon:
+                if( c != ':' ) st.fail( "Expected ':' after key in object", at() );
+                ++p;
+                st.mode = Mode::Value;
+                break;
+
+            case Mode::CommaOrEnd:
+                if( st.stack.back() == '{' ) {
+                    if     ( c == ',' ) st.mode = Mode::Key;
+                    else if( c == '}' ) st.close();
+                    else st.fail( "Expected ',' or '}' after property in object", at() );
+                } else {
+                    if     ( c == ',' ) st.mode = Mode::Value;
+                    else if( c == ']' ) st.close();
+                    else st.fail( "Expected ',' or ']' after element in array", at() );
+                }
+                ++p;
+                break;
+
+            default:
+                break;
+            }
+            break;
+        }
+        }
+    }
+
+    st.offset += length;
+}
+
+void StreamParser::finish()
+{
+    using Mode = State::Mode;
+    State& st = this->checkedState();
+
+    if( st.failed )
+        throw TinyJsonException( "StreamParser is in a failed state; call reset()" );
+
+    if( st.mode == Mode::Number || st.mode == Mode::Literal )
+        st.endAtom( nullptr, st.offset );
+
+    if( st.mode == Mode::String )
+        st.fail( "Unterminated string", st.offset );
+    if( st.mode != Mode::Value || !st.stack.empty() )
+        st.fail( "Unexpected end of input", st.offset );
+
+    st.offset = 0;
+}
+
+bool StreamParser::hasValue() const
+{
+    return !this->checkedState().ready.empty();
+}
+
+Json StreamParser::next()
+{
+    State& st = this->checkedState();
+    if( st.ready.empty() )
+        throw TinyJsonException( "StreamParser has no completed value" );
+
+    Json value = std::move( st.ready.front() );
+    st.ready.pop_front();
+    return value;
+}
+
+void StreamParser::reset()
+{
+    // A moved-from parser starts over with default options and no callback
+    if( !this->state )
+        this->state.reset( new State( Callback(), ParseOptions() ) );
+    else
+        this->state.reset( new State( std::move( this->state->onValue ), this->state->options ) );
+}
+
+// =============================================================================
+// [Lazy Json Implementation]
+// =============================================================================
+
+namespace {
+
+inline const char* skipSpace( const char* p, const char* end ) noexcept
+{
+    while( p < end && ( *p == ' ' || *p == '\t' || *p == '\n' || *p == '\r' ) ) ++p;
+    return p;
+}
+
+/**
+ * @brief Finds the closing quote of a string in validated text.
+ * `p` points at the opening quote.
+ */
+const char* closingQuote( const char* p, const char* end ) noexcept
+{
+    const char* from = p + 1;
+    while( true )
+    {
+        const char* q = static_cast<const char*>( std::memchr( from, '"', end - from ) );
+        const char* b = q;
+        while( b > from && b[-1] == '\\' ) --b;
+        if( ( ( q - b ) & 1 ) == 0 ) return q; // not escaped
+        from = q + 1;
+    }
+}
+
+} // namespace
+
+/**
+ * @brief Builds the members of a lazy container from its extent. The text
+ * was validated by parseLazy(), so only one level is scanned here: nested
+ * containers become lazy nodes and are skipped using their recorded extent.
+ */
+void Json::materialize() const
+{
+    // Detach first: a failure must not leave the node half lazy
+    Container&                              c    = *this->val.box;
+    const std::shared_ptr<const LazySource> src  = std::move( c.lazySrc );
+    const LazySource::Extent&               self = src->extents[c.lazyNode];
+
+    const char* const text = src->text.data();
+    const char*       p    = text + self.begin + 1;
+    const char* const end  = text + self.end - 1; // closing bracket
+    uint32_t          next = c.lazyNode + 1;      // first nested container
+
+    const bool  isObj = ( this->jType == JsonType::OBJECT );
+    std::string key;
+
+    while( ( p = skipSpace( p, end ) ) < end )
+    {
+        if( isObj )
+        {
+            const char* q = closingQuote( p, end );
+            assignUnescaped( key, p + 1, q - p - 1, std::memchr( p + 1, '\\', q - p - 1 ) != nullptr );
+            p = skipSpace( q + 1, end ) + 1; // ':'
+            p = skipSpace( p, end );
+        }
 
-    auto it = this->mapIndex.find( key );
-    if( it == this->mapIndex.end() )
-        throw TinyJsonException( "Key not found: " + key );
+        Json value;
+        switch( *p )
+        {
+        case '{':
+        case '[':
+            value.reset( ( *p == '{' ) ? JsonType::OBJECT : JsonType::ARRAY );
+            value.val.box->lazySrc  = src;
+            value.val.box->lazyNode = next;
+            p     = text + src->extents[next].end;
+            next += src->extents[next].span;
+            break;
+        case '"': {
+            const char* q = closingQuote( p, end );
+            value.adoptString( SharedString::decode( p + 1, q - p - 1, std::memchr( p + 1, '\\', q - p - 1 ) != nullptr ) );
+            p = q + 1;
+            break;
+        }
+        case 't': value.setBoolean( true );           p += 4; break;
+        case 'f': value.setBoolean( false );          p += 5; break;
+        case 'n': value.reset( JsonType::NULL_TYPE ); p += 4; break;
+        default: {
+            const char* q    = p;
+            JsonType    type = JsonType::INT;
+            for( ; q < end && !isDelimiter( *q ); ++q ) {
+                if( *q == '.' || *q == 'e' || *q == 'E' ) type = JsonType::DOUBLE;
+            }
+            value.setNumber( p, q - p, type );
+            p = q;
+            break;
+        }
+        }
 
-    return this->properties[it->second].second;
+        if( !isObj ) {
+            c.arr.push_back( std::move( value ) );
+        } else {
+            // Duplicate keys overwrite the earlier value, as in Parser::parse
+            const std::size_t found = c.find( key );
+            if( found != Container::NOT_FOUND )
+                c.properties[found].second = std::move( value );
+            else
+                c.append( src->keys.intern( key ), std::move( value ) );
+        }
+
+        p = skipSpace( p, end );
+        if( p < end && *p == ',' ) ++p;
+    }
 }
 
 // =============================================================================
-// [Value Accessors (Template Specializations)]
+// [ViewDocument & JsonView Implementation]
 // =============================================================================
 
-template <typename T>
-T Json::getAs() const
-{
-    T ret;
-    std::stringstream ss( this->strValue );
-    ss >> ret;
-    return ret;
-}
 
-template <>
-bool Json::getAs<bool>() const
+JsonView ViewDocument::root() const noexcept
 {
-    return ( this->strValue == "true" );
+    return JsonView( this->nodes.empty() ? nullptr : this->nodes.data() );
 }
 
-template <>
-std::string Json::getAs<std::string>() const
+JsonView JsonView::operator[]( const int i ) const
 {
-    return this->deserialize( this->strValue );
+    if( !this->isArray() )
+        throw TinyJsonException( "Invalid access: Operator[] int used on non-array type" );
+
+    if( i < 0 || static_cast<uint32_t>( i ) >= this->node->count )
+        throw TinyJsonException( "Index out of range" );
+
+    const ViewDocument::Node* n = this->node + 1;
+    for( int k = 0; k < i; ++k )
+        n += n->span;
+    return JsonView( n );
 }
 
-template <>
-int Json::getAs<int>() const
+JsonView JsonView::operator[]( StringView key ) const
 {
-    try {
-        return std::stoi( this->strValue );
+    if( !this->isObject() )
+        throw TinyJsonException( "Invalid access: Operator[] string used on non-object type" );
+
+    for( auto it = this->begin(); it != this->end(); ++it ) {
+        if( it.key() == key )
+            return *it;
     }
-    catch ( ... ) { return 0; }
+    throw TinyJsonException( "Key not found: " + key.toString() );
 }
 
-template <>
-double Json::getAs<double>() const
+bool JsonView::contains( StringView key ) const noexcept
 {
-    try {
-        return std::stod( this->strValue );
+    if( !this->isObject() )
+        return false;
+
+    for( auto it = this->begin(); it != this->end(); ++it ) {
+        if( it.key() == key )
+            return true;
     }
-    catch ( ... ) { return 0.0; }
+    return false;
 }
 
-// =============================================================================
-// [Utility Methods]
-// =============================================================================
-
-std::size_t Json::size() const noexcept
+std::size_t JsonView::size() const noexcept
 {
-    if( this->jType == JsonType::ARRAY )  return this->arr.size();
-    if( this->jType == JsonType::OBJECT ) return this->properties.size();
-    return 0;
+    return ( this->isArray() || this->isObject() ) ? this->node->count : 0;
 }
 
-std::vector<std::string> Json::keys() const
+std::vector<std::string> JsonView::keys() const
 {
     std::vector<std::string> k;
-    if( this->jType == JsonType::OBJECT ){
-        for( auto& pair : this->properties ){
-            k.push_back( pair.first );
-        }
+    if( this->isObject() ) {
+        for( auto it = this->begin(); it != this->end(); ++it )
+            k.push_back( it.key().toString() );
     }
     return k;
 }
 
-bool Json::contains( const std::string& key ) const
+JsonView::const_iterator JsonView::begin() const
 {
-    // Object가 아니면 키를 가질 수 없음
-    if( this->jType != JsonType::OBJECT ) {
-        return false;
-    }
-
-    return this->mapIndex.find( key ) != this->mapIndex.end();
+    if( this->isArray() || this->isObject() )
+        return const_iterator( this->node + 1, this->isObject(), 0 );
+    return const_iterator( this->node, false, 0 );
 }
 
-std::string Json::toString( ToStringType type ) const noexcept
+JsonView::const_iterator JsonView::end() const
 {
-    return ( type == ToStringType::Pretty )
-        ? this->toStringPretty( 2 )
-        : this->toStringStrip();
+    return const_iterator( this->node, this->isObject(), this->size() );
 }
 
-bool Json::saveFile( const char* filename ) const
+template <>
+int JsonView::getAs<int>() const
 {
-    std::ofstream file( filename );
-
-    if( !file.is_open() )
-        return false;
-
-    file << this->toString( ToStringType::Pretty );
-    file.close();
-
-    return true;
-}
-
-// =============================================================================
-// [Data Modification]
-// =============================================================================
+    if( !this->node || !this->node->str ) return 0;
 
-Json& Json::addObject( const Json& objectValue )
-{
-    // [Case 1] Push to Array
-    if( this->jType == JsonType::ARRAY )
-    {
-        this->addElement( objectValue );
-        return ( *this );
-    }
+    using Limits = std::numeric_limits<int>;
+    const StringView text( this->node->str, this->node->len );
 
-    // [Case 2] Merge to Object
-    if( objectValue.isObject() )
+    // Same range checks as Json::getAs<int>
+    if( this->isInt() || this->isDouble() )
     {
-        this->setType( JsonType::OBJECT );
-
-        for( const auto& prop : objectValue.properties ){
-            this->addProperty( prop.first, prop.second );
+        int64_t i = 0;
+        if( this->isInt() && parseInt64( text.data(), text.size(), i ) ) {
+            if( i >= Limits::min() && i <= Limits::max() )
+                return static_cast<int>( i );
         }
-        return ( *this );
+        else if( this->isDouble() ) {
+            const double d = parseDouble( text.data(), text.size() );
+            if( truncatesInto<int>( d ) )
+                return static_cast<int>( d );
+        }
+        throw TinyJsonException( "Number out of range for requested type: " + text.toString() );
     }
 
-    throw TinyJsonException( "Cannot add a non-object value to an Object without a key." );
-}
-
-// =============================================================================
-// [Iteration Methods]
-// =============================================================================
-
-Json::iterator Json::begin()
-{
-    return iterator( this->jType, this->arr.begin(), this->arr.begin(), this->properties.begin() );
+    // Strings holding numbers: 0 when out of range, like std::stoi failing
+    const long long v = convertText<long long>( text,
+        []( const char* s, char** e ) { return std::strtoll( s, e, 10 ); } );
+    return ( v >= Limits::min() && v <= Limits::max() ) ? static_cast<int>( v ) : 0;
 }
 
-Json::iterator Json::end()
+template <>
+double JsonView::getAs<double>() const
 {
-    return iterator( this->jType, this->arr.end(), this->arr.begin(), this->properties.end() );
-}
+    if( !this->node || !this->node->str ) return 0.0;
+    if( this->isInt() || this->isDouble() )
+        return parseDouble( this->node->str, this->node->len );
 
-Json::const_iterator Json::begin() const
-{
-    return const_iterator( this->jType, this->arr.begin(), this->arr.begin(), this->properties.begin() );
+    return convertText<double>( StringView( this->node->str, this->node->len ),
+        []( const char* s, char** e ) { return std::strtod( s, e ); } );
 }
 
-Json::const_iterator Json::end() const
+template <>
+bool JsonView::getAs<bool>() const
 {
-    return const_iterator( this->jType, this->arr.end(), this->arr.begin(), this->properties.end() );
+    return this->isBool() && this->node->len == 4; // "true"
 }
 
-Json::ItemsRange<Json::iterator> Json::items()
+template <>
+std::string JsonView::getAs<std::string>() const
 {
-    return ItemsRange<iterator>( begin(), end() );
+    return this->getAs<StringView>().toString();
 }
 
-Json::ItemsRange<Json::const_iterator> Json::items() const
+template <>
+StringView JsonView::getAs<StringView>() const
 {
-    return ItemsRange<const_iterator>( begin(), end() );
+    if( !this->node || !this->node->str ) return StringView();
+    return StringView( this->node->str, this->node->len );
 }
 
 // =============================================================================
-// [Internal Helpers]
+// [Arena & Document Implementation]
 // =============================================================================
 
-std::string Json::deserialize( const std::string& src ) noexcept
+struct Arena::Block
 {
-    std::string out = "";
-
-    for( std::size_t i = 0; i < src.length(); ++i )
-    {
-        if( src[i] == '\\' && i + 1 < src.length() )
-        {
-            char next = src[i+1];
-            switch( next ) {
-                case '"':  out += '"';  break;
-                case '\\': out += '\\'; break;
-                case '/':  out += '/';  break;
-                case 'b':  out += '\b'; break;
-                case 'f':  out += '\f'; break;
-                case 'n':  out += '\n'; break;
-                case 'r':  out += '\r'; break;
-                case 't':  out += '\t'; break;
-                default:   out += next; break;
-            }
-            i++;
-        }
-        else {
-            out += src[i];
-        }
-    }
-    return out;
-}
+    Block* prev;
+};
 
-std::string Json::serialize( const std::string& src ) noexcept
+Arena::Arena( std::size_t blockSize ) noexcept
+    : head( nullptr ), cur( nullptr ), end( nullptr ), blockSize( blockSize ), total( 0 )
 {
-    std::string out = "";
-
-    for( char c : src )
-    {
-        switch( c ){
-            case '\n': out += "\\n";  break;
-            case '\t': out += "\\t";  break;
-            case '\b': out += "\\b";  break;
-            case '\r': out += "\\r";  break;
-            case '\f': out += "\\f";  break;
-            case '"':  out += "\\\""; break;
-            case '\\': out += "\\\\"; break;
-            default:   out += c;      break;
-        }
-    }
-    return out;
 }
 
-std::string Json::makeSpace( const unsigned int space ) const noexcept
+Arena::~Arena()
 {
-    return std::string( space, ' ' );
+    this->release();
 }
 
-std::string Json::toStringStrip() const noexcept
+void* Arena::allocate( std::size_t bytes, std::size_t align )
 {
-    switch( this->jType )
+    std::size_t pad = static_cast<std::size_t>( -reinterpret_cast<uintptr_t>( this->cur ) ) & ( align - 1 );
+    if( !this->head || bytes + pad > static_cast<std::size_t>( this->end - this->cur ) )
     {
-    case JsonType::STRING:    return "\"" + this->strValue + "\"";
-    case JsonType::INT:       return strValue;
-    case JsonType::DOUBLE:    return strValue;
-    case JsonType::BOOLEAN:   return strValue;
-    case JsonType::NULL_TYPE: return "null";
+        // Blocks start max_align_t aligned; `align` bytes of slack cover any padding
+        const std::size_t header = ( sizeof( Block ) + alignof( std::max_align_t ) - 1 ) & ~( alignof( std::max_align_t ) - 1 );
+        const std::size_t size   = std::max( this->blockSize, header + bytes + align );
 
-    case JsonType::OBJECT:
-    {
-        std::string s = "{ ";
-        for( std::size_t i = 0; i < this->properties.size(); ++i )
-        {
-            s += "\"" + this->properties[i].first + "\": " + this->properties[i].second.toStringStrip();
-            if( i < this->properties.size() - 1 ) { s += ", "; }
-        }
-        s += " }";
-        return s;
-    }
+        Block* block = static_cast<Block*>( ::operator new( size ) );
+        block->prev  = this->head;
 
-    case JsonType::ARRAY:
-    {
-        std::string s = "[ ";
-        for( std::size_t i = 0; i < this->arr.size(); ++i )
-        {
-            s += this->arr[i].toStringStrip();
-            if( i < this->arr.size() - 1 ) { s += ", "; }
-        }
-        s += " ]";
-        return s;
-    }
-    default: return "";
+        this->head   = block;
+        this->cur    = reinterpret_cast<char*>( block ) + header;
+        this->end    = reinterpret_cast<char*>( block ) + size;
+        this->total += size;
+        pad = static_cast<std::size_t>( -reinterpret_cast<uintptr_t>( this->cur ) ) & ( align - 1 );
     }
+
+    char* p   = this->cur + pad;
+    this->cur = p + bytes;
+    return p;
 }
 
-std::string Json::toStringPretty( const unsigned int space ) const noexcept
+void Arena::release() noexcept
 {
-    switch( this->jType )
-    {
-    case JsonType::STRING:    return "\"" + this->strValue + "\"";
-    case JsonType::INT:       return strValue;
-    case JsonType::DOUBLE:    return strValue;
-    case JsonType::BOOLEAN:   return strValue;
-    case JsonType::NULL_TYPE: return "null";
-
-    case JsonType::OBJECT:
-    {
-        std::string s = "{\n";
-        for( std::size_t i = 0; i < this->properties.size(); ++i )
-        {
-            s += makeSpace( space )
-               + "\"" + this->properties[i].first + "\": "
-               + this->properties[i].second.toStringPretty( space + 2 );
-
-            if( i < this->properties.size() - 1 ) { s += ",\n"; }
-            else                                  { s += "\n";  }
-        }
-        s += makeSpace( space > 2 ? space - 2 : 0 ) + "}";
-        return s;
-    }
-
-    case JsonType::ARRAY:
-    {
-        std::string s = "[ ";
-        for( std::size_t i = 0; i < this->arr.size(); ++i )
-        {
-            s += this->arr[i].toStringPretty( space );
-            if( i < this->arr.size() - 1 ) { s += ", "; }
-        }
-        s += " ]";
-        return s;
-    }
-    default: return "";
+    while( this->head ) {
+        Block* prev = this->head->prev;
+        ::operator delete( this->head );
+        this->head = prev;
     }
+    this->cur   = nullptr;
+    this->end   = nullptr;
+    this->total = 0;
 }
 
-// Low-level manipulators
-void Json::setString( const std::string& s ) noexcept
+Document::Document( std::size_t blockSize )
+    : blockSize( blockSize )
+    , arena( new Arena( blockSize ) )
 {
-    this->strValue = this->serialize( s );
 }
 
-Json& Json::setType( const JsonType type )
+void Document::reset() noexcept
 {
-    this->jType = type;
-    return ( *this );
+    this->view = ViewDocument(); // node storage is arena memory: nothing to free here
+    if( this->arena ) this->arena->release();
 }
 
-void Json::addProperty( const std::string& k, const Json& v )
+JsonView Document::parse( StringView text, const ParseOptions& options )
 {
-    if( this->mapIndex.find( k ) != this->mapIndex.end() )
-    {
-        this->properties[this->mapIndex[k]].second = v;
-    }
-    else
-    {
-        this->mapIndex[k] = this->properties.size();
-        this->properties.emplace_back( k, v );
-    }
+    const ParseResult result = this->tryParse( text, options );
+    if( result.error == ParseError::OutOfMemory )
+        throw std::bad_alloc();
+    if( !result )
+        throwParseError( result );
+    return this->root();
 }
 
-void Json::addElement( const Json& v )
+ParseResult Document::tryParse( StringView text, const ParseOptions& options ) noexcept
 {
-    this->arr.push_back( v );
+    this->reset();
+    try {
+        if( !this->arena ) this->arena.reset( new Arena( this->blockSize ) ); // moved-from
+
+        // One copy of the text; strings are decoded and terminated inside it
+        char* const buffer = static_cast<char*>( this->arena->allocate( text.size() + 1, 1 ) );
+        std::memcpy( buffer, text.data(), text.size() );
+        buffer[text.size()] = '\0';
+
+        this->view.nodes = std::vector<ViewDocument::Node, ArenaAllocator<ViewDocument::Node>>( this->arena.get() );
+        Parser::ViewBuilder builder( this->view, buffer );
+        const ParseResult   result = Parser::parseDocument( buffer, text.size(), builder, options );
+        if( !result )
+            this->reset();
+        return result;
+    }
+    catch( const std::bad_alloc& ) {
+        this->reset();
+        return ParseResult{ ParseError::OutOfMemory };
+    }
 }
 
 // =============================================================================
-// [Parser Implementation]
+// [TapeDocument & TapeView Implementation]
 // =============================================================================
 
-bool Parser::isObject( const std::string& str ) noexcept
+TapeView TapeDocument::root() const noexcept
 {
-    try {
-        return !Parser::tokenize( str ).empty();
-    } catch( ... ) {
-        return false;
-    }
+    return TapeView( this->tape.empty() ? nullptr : this->tape.data(), this->strings.data() );
 }
 
-bool Parser::isObject( const char* str ) noexcept
+JsonType TapeView::type() const noexcept
 {
-    return Parser::isObject( std::string( str ) );
+    if( !this->word ) return JsonType::UNKNOWN;
+
+    switch( TapeDocument::tagOf( *this->word ) ) {
+        case TapeDocument::TagNull:   return JsonType::NULL_TYPE;
+        case TapeDocument::TagTrue:
+        case TapeDocument::TagFalse:  return JsonType::BOOLEAN;
+        case TapeDocument::TagInt64:
+        case TapeDocument::TagUInt64:
+        case TapeDocument::TagBigInt: return JsonType::INT;
+        case TapeDocument::TagDouble:
+        case TapeDocument::TagBigDouble: return JsonType::DOUBLE;
+        case TapeDocument::TagString: return JsonType::STRING;
+        case TapeDocument::TagObject: return JsonType::OBJECT;
+        case TapeDocument::TagArray:  return JsonType::ARRAY;
+    }
+    return JsonType::UNKNOWN;
 }
 
-inline bool Parser::isWhiteSpace( const char c )
+TapeView TapeView::operator[]( const int i ) const
 {
-    return isspace( c );
+    if( !this->isArray() )
+        throw TinyJsonException( "Invalid access: Operator[] int used on non-array type" );
+
+    if( i < 0 || static_cast<std::size_t>( i ) >= this->size() )
+        throw TinyJsonException( "Index out of range" );
+
+    const uint64_t* w = this->word + 1;
+    for( int k = 0; k < i; ++k )
+        w += width( w );
+    return TapeView( w, this->strings );
 }
 
-int Parser::nextWhiteSpace( const std::string& src, const int startPos ) noexcept
+TapeView TapeView::operator[]( StringView key ) const
 {
-    int       i   = startPos;
-    const int len = (int)src.length();
+    if( !this->isObject() )
+        throw TinyJsonException( "Invalid access: Operator[] string used on non-object type" );
 
-    while( i < len )
-    {
-        if( src[i] == '"' ) {
-            ++i;
-            while( i < len && ( src[i] != '"' || src[i-1] == '\\' ) ) { ++i; }
-        }
-        if( src[i] == '\'' ) {
-            ++i;
-            while( i < len && ( src[i] != '\'' || src[i-1] == '\\' ) ) { ++i; }
-        }
-        if( isWhiteSpace( src[i] ) ) { return i; }
-        ++i;
+    for( auto it = this->begin(); it != this->end(); ++it ) {
+        if( it.key() == key )
+            return *it;
     }
-    return len;
+    throw TinyJsonException( "Key not found: " + key.toString() );
 }
 
-int Parser::skipWhiteSpaces( const std::string& src, const int pos ) noexcept
+bool TapeView::contains( StringView key ) const noexcept
 {
-    int       i   = pos;
-    const int len = (int)src.length();
+    if( !this->isObject() )
+        return false;
 
-    while( i < len )
-    {
-        if( !isWhiteSpace( src[i] ) ) { return i; }
-        ++i;
+    for( auto it = this->begin(); it != this->end(); ++it ) {
+        if( it.key() == key )
+            return true;
     }
-    return -1;
+    return false;
 }
 
-std::vector<Parser::Token> Parser::tokenize( const std::string& src )
+std::size_t TapeView::size() const noexcept
 {
-    std::vector<Token> tokens;
-    int idx = Parser::skipWhiteSpaces( src, 0 );
-
-    int check_brace   = 0;
-    int check_bracket = 0;
-
-    while( idx >= 0 )
-    {
-        int next = Parser::nextWhiteSpace( src, idx );
+    if( !this->isArray() && !this->isObject() )
+        return 0;
 
-        std::string str = src.substr( idx, next - idx );
-        std::size_t len = str.length();
-        std::size_t k   = 0;
+    const uint32_t count = TapeDocument::countOf( *this->word );
+    if( count < TapeDocument::COUNT_SATURATED )
+        return count;
 
-        while( k < len )
-        {
-            char c = str[k];
-            if( c == '"' )
-            {
-                std::size_t tmp = k + 1;
-                while( tmp < len && ( str[tmp] != '"' || str[tmp-1] == '\\' ) ) {
-                    ++tmp;
-                }
-                tokens.emplace_back( str.substr( k + 1, tmp - k - 1 ), TokenType::STRING );
-                k = tmp + 1;
-            }
-            else if( c == ',' ) {
-                tokens.emplace_back( ",", TokenType::COMMA );
-                ++k;
-            }
-            else if( c == '{' ) {
-                tokens.emplace_back( "{", TokenType::CBRACE_OPEN );
-                ++k; ++check_brace;
-            }
-            else if( c == '}' ) {
-                tokens.emplace_back( "}", TokenType::CBRACE_CLOSE );
-                ++k; --check_brace;
-            }
-            else if( c == '[' ) {
-                tokens.emplace_back( "[", TokenType::BRACKET_OPEN );
-                ++k; ++check_bracket;
-            }
-            else if( c == ']' ) {
-                tokens.emplace_back( "]", TokenType::BRACKET_CLOSE );
-                ++k; --check_bracket;
-            }
-            else if( c == ':' ) {
-                tokens.emplace_back( ":", TokenType::COLON );
-                ++k;
-            }
-            else if( c == 't' && k + 3 < len && str.substr( k, 4 ) == "true" ) {
-                tokens.emplace_back( "true", TokenType::BOOLEAN );
-                k += 4;
-            }
-            else if( c == 'f' && k + 4 < len && str.substr( k, 5 ) == "false" ) {
-                tokens.emplace_back( "false", TokenType::BOOLEAN );
-                k += 5;
-            }
-            else if( c == 'n' && k + 3 < len && str.substr( k, 4 ) == "null" ) {
-                tokens.emplace_back( "null", TokenType::NULL_TYPE );
-                k += 4;
-            }
-            else if( c == '-' || ( c >= '0' && c <= '9' ) )
-            {
-                std::size_t tmp = k;
-                if( str[tmp] == '-' ) { ++tmp; }
+    // Too many children for the count field: walk them
+    const bool      obj  = this->isObject();
+    const uint64_t* w    = this->word + 1;
+    const uint64_t* last = this->word + TapeDocument::spanOf( *this->word );
+    std::size_t     n    = 0;
+    for( ; w != last; ++n )
+        w += obj ? 1 + width( w + 1 ) : width( w );
+    return n;
+}
 
-                TokenType type = TokenType::INT;
-                while( tmp < len && ( ( str[tmp] >= '0' && str[tmp] <= '9' ) || str[tmp] == '.' ) ) {
-                    if( str[tmp] == '.' ) { type = TokenType::DOUBLE; }
-                    ++tmp;
-                }
-                tokens.emplace_back( str.substr( k, tmp - k ), type );
-                k = tmp;
-            }
-            else {
-                // ++k;
-                throw TinyJsonException( "Invalid character in JSON" );
-            }
-        }
-        idx = Parser::skipWhiteSpaces( src, next );
+std::vector<std::string> TapeView::keys() const
+{
+    std::vector<std::string> k;
+    if( this->isObject() ) {
+        for( auto it = this->begin(); it != this->end(); ++it )
+            k.push_back( it.key().toString() );
     }
-
-    if( check_brace != 0 || check_bracket != 0 )
-        throw TinyJsonException( "Mismatched brackets or braces in JSON" );
-
-    return tokens;
+    return k;
 }
 
-Json Parser::jsonParse( const std::vector<Token>& v, int& curPos )
+TapeView::const_iterator TapeView::begin() const
 {
-    if( curPos >= (int)v.size() )
-        return JsonNULL();
-
-    Token token = v[curPos];
-    Json  current( JsonType::UNKNOWN );
-
-    if( token.type == TokenType::CBRACE_OPEN )
-    {
-        current.setType( JsonType::OBJECT );
-        int k = curPos + 1;
-
-        while( k < (int)v.size() && v[k].type != TokenType::CBRACE_CLOSE )
-        {
-            std::string key = v[k].value;
-
-            if( v[k+1].type != TokenType::COLON )
-                throw TinyJsonException( "Expected ':' after key in object" );
-
-            int nextPos = k + 2;
-            Json val = Parser::jsonParse( v, nextPos );
+    if( this->isArray() || this->isObject() )
+        return const_iterator( this->word + 1, this->strings, this->isObject(), 0 );
+    return const_iterator( this->word, this->strings, false, 0 );
+}
 
-            current.addProperty( key, val );
-            k = nextPos;
+TapeView::const_iterator TapeView::end() const
+{
+    return const_iterator( this->word, this->strings, this->isObject(), this->size() );
+}
 
-            if( k < (int)v.size() )
-            {
-                if( v[k].type == TokenType::COMMA ) {
-                    ++k;
-                } else if( v[k].type == TokenType::CBRACE_CLOSE ) {
-                    continue;
-                } else {
-                    throw TinyJsonException( "Expected ',' or '}' after property in object" );
-                }
-            }
-        }
-        curPos = k + 1;
-    }
-    else if( token.type == TokenType::BRACKET_OPEN )
-    {
-        current.setType( JsonType::ARRAY );
-        int k = curPos + 1;
+Json TapeView::scalar() const
+{
+    if( !this->word ) return Json( JsonType::UNKNOWN );
 
-        while( k < (int)v.size() && v[k].type != TokenType::BRACKET_CLOSE )
+    const uint64_t* w = this->word;
+    switch( TapeDocument::tagOf( *w ) ) {
+        case TapeDocument::TagTrue:   return Json( true );
+        case TapeDocument::TagFalse:  return Json( false );
+        case TapeDocument::TagInt64:  return Json( static_cast<long long>( static_cast<int64_t>( w[1] ) ) );
+        case TapeDocument::TagUInt64: return Json( static_cast<unsigned long long>( w[1] ) );
+        case TapeDocument::TagString: return Json( text( *w, this->strings ).toString() );
+        case TapeDocument::TagDouble:
         {
-            int  nextPos = k;
-            Json val     = Parser::jsonParse( v, nextPos );
-
-            current.addElement( val );
-            k = nextPos;
-
-            if( k < (int)v.size() && v[k].type == TokenType::COMMA ) { ++k; }
+            double d;
+            std::memcpy( &d, &w[1], sizeof( d ) );
+            return Json( d );
         }
-        curPos = k + 1;
-    }
-    else
-    {
-        switch( token.type )
+        case TapeDocument::TagBigInt:
+        case TapeDocument::TagBigDouble:
         {
-        case TokenType::STRING:
-            current.setType( JsonType::STRING );
-            current.strValue = token.value;
-            break;
-        case TokenType::INT:
-            current.setType( JsonType::INT ).setString( token.value );
-            break;
-        case TokenType::DOUBLE:
-            current.setType( JsonType::DOUBLE ).setString( token.value );
-            break;
-        case TokenType::BOOLEAN:
-            current.setType( JsonType::BOOLEAN ).setString( token.value );
-            break;
-        case TokenType::NULL_TYPE:
-            current.setType( JsonType::NULL_TYPE ).setString( "null" );
-            break;
-        default:
-            break;
+            Json big( JsonType::NULL_TYPE );
+            big.assignJson( text( *w, this->strings ) ); // keeps the source text
+            return big;
         }
-        curPos++;
+        default: return Json( JsonType::NULL_TYPE ); // null; containers have no scalar value
     }
-    return current;
 }
 
-Json Parser::parse( const char* str )
+Json TapeView::toJson() const
 {
-    return Parser::parse( std::string( str ) );
+    if( this->isArray() ) {
+        Json arr = JsonArray();
+        arr.reserve( this->size() );
+        for( const TapeView v : *this ) arr.emplaceBack( v.toJson() );
+        return arr;
+    }
+    if( this->isObject() ) {
+        Json obj = JsonObject();
+        obj.reserve( this->size() );
+        for( auto it = this->begin(); it != this->end(); ++it )
+            obj.emplace( it.key().toString(), it.value().toJson() );
+        return obj;
+    }
+    return this->scalar();
 }
 
-Json Parser::parse( const std::string& str )
+std::string TapeView::toString( ToStringType type, bool asciiOnly ) const
 {
-    try {
-        std::vector<Token> tokens = Parser::tokenize( str );
-        if( tokens.empty() )
-            return JsonNULL();
-
-        int pos = 0;
-        return Parser::jsonParse( tokens, pos );
-    }
-    catch( const std::exception& e ) {
-        throw TinyJsonException( std::string( "Parse Error: " ) + e.what() );
-    }
+    return this->toJson().toString( type, asciiOnly );
 }
 
-Json Parser::parseFile( const std::string& fileName )
+template <>
+std::string TapeView::getAs<std::string>() const
 {
-    std::ifstream ifs( fileName );
-    if( !ifs.is_open() )
-        throw TinyJsonException( "File open failed: " + fileName );
+    if( this->isString() ) return this->getAs<StringView>().toString();
+    if( this->isObject() || this->isArray() ) return std::string(); // containers have no text
+    return this->scalar().getAs<std::string>();
+}
 
-    std::stringstream buffer;
-    buffer << ifs.rdbuf();
-    return Parser::parse( buffer.str() );
+template <>
+StringView TapeView::getAs<StringView>() const
+{
+    if( !this->isString() ) return StringView();
+    return text( *this->word, this->strings );
 }
 
-} // namespace TinyJson
\ No newline at end of file
+} // namespace TinyJson
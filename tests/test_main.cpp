@@ -13,10 +13,17 @@
 
 // STL
 #include <cstdio>    // for remove()
+#include <cstdlib>   // for strtod()
+#include <cmath>     // for std::nan
+#include <limits>
 #include <string>
 #include <vector>
 #include <algorithm> // for std::find_if
 #include <memory>
+#include <sstream>   // for std::istringstream
+#include <stdexcept>
+#include <fstream>
+#include <thread>
 
 // TinyJson Header
 #include "TinyJson.h"
@@ -525,4 +532,1919 @@ TEST_CASE( "Utilities", "[utility]" )
         Json arr = JsonArray();
         REQUIRE( arr.contains( "key" ) == false );
     }
-}
\ No newline at end of file
+}
+// =============================================================================
+// [Test 9] Single-pass Parser (Grammar & Error Positions)
+// Verify the recursive-descent parser against the JSON grammar.
+// =============================================================================
+TEST_CASE( "Single-pass Parser", "[parser]" )
+{
+    SECTION( "Nested Structures" )
+    {
+        Json js = Parser::parse( "{\"a\":[1,{\"b\":[true,false,null]},-2.5e3],\"c\":{}}" );
+
+        REQUIRE( js["a"].size() == 3 );
+        REQUIRE( js["a"][1]["b"][0].getAs<bool>() == true );
+        REQUIRE( js["a"][1]["b"][2].isNull() );
+        REQUIRE( js["a"][2].isDouble() );
+        REQUIRE_THAT( js["a"][2].getAs<double>(), Catch::Matchers::WithinRel( -2500.0, 0.0001 ) );
+        REQUIRE( js["c"].isObject() );
+        REQUIRE( js["c"].size() == 0 );
+    }
+
+    SECTION( "Explicit Length (Not Null-Terminated)" )
+    {
+        const char buf[] = { '[', '1', ',', '2', ']', 'x', 'x' };
+        Json js = Parser::parse( buf, 5 );
+
+        REQUIRE( js.isArray() );
+        REQUIRE( js.size() == 2 );
+    }
+
+    SECTION( "Duplicate Keys (Last Wins)" )
+    {
+        Json js = Parser::parse( "{ \"k\": 1, \"k\": \"two\" }" );
+
+        REQUIRE( js.size() == 1 );
+        REQUIRE( js["k"].getAs<std::string>() == "two" );
+    }
+
+    SECTION( "Whitespace & Empty Input" )
+    {
+        REQUIRE( Parser::parse( " \n\t{ \"a\" :\r\n 1 } \n" )["a"].getAs<int>() == 1 );
+        REQUIRE( Parser::parse( "" ).isNull() );
+        REQUIRE( Parser::parse( "   " ).isNull() );
+    }
+
+    SECTION( "Malformed Input" )
+    {
+        REQUIRE_THROWS_AS( Parser::parse( "[1, 2" ),          TinyJsonException );
+        REQUIRE_THROWS_AS( Parser::parse( "{\"a\" 1}" ),      TinyJsonException );
+        REQUIRE_THROWS_AS( Parser::parse( "{\"a\":1,}" ),     TinyJsonException );
+        REQUIRE_THROWS_AS( Parser::parse( "[1 2]" ),          TinyJsonException );
+        REQUIRE_THROWS_AS( Parser::parse( "1 2" ),            TinyJsonException );
+        REQUIRE_THROWS_AS( Parser::parse( "012" ),            TinyJsonException );
+        REQUIRE_THROWS_AS( Parser::parse( "1." ),             TinyJsonException );
+        REQUIRE_THROWS_AS( Parser::parse( "\"abc" ),          TinyJsonException );
+        REQUIRE_THROWS_AS( Parser::parse( "\"bad \\x\"" ),    TinyJsonException );
+        REQUIRE_THROWS_AS( Parser::parse( "tru" ),            TinyJsonException );
+        REQUIRE_THROWS_AS( Parser::parse( "nulls" ),          TinyJsonException );
+    }
+
+    SECTION( "Error Message Carries Offset" )
+    {
+        try {
+            Parser::parse( "[1, 2 x]" );
+            FAIL( "parse should have thrown" );
+        } catch( const TinyJsonException& e ) {
+            REQUIRE( std::string( e.what() ).find( "offset 6" ) != std::string::npos );
+        }
+    }
+}
+
+// =============================================================================
+// [Test 10] Structural Index (Block Boundaries & Escapes)
+// Verify that the vectorized pre-pass tracks strings and escapes across
+// 64-byte block boundaries.
+// =============================================================================
+TEST_CASE( "Structural Index", "[parser][simd]" )
+{
+    SECTION( "Structural Characters Inside Strings" )
+    {
+        Json js = Parser::parse( "{ \"k\": \"{ [ : , ] }\", \"n\": 1 }" );
+
+        REQUIRE( js.size() == 2 );
+        REQUIRE( js["k"].getAs<std::string>() == "{ [ : , ] }" );
+        REQUIRE( js["n"].getAs<int>() == 1 );
+    }
+
+    SECTION( "Escapes Across Block Boundaries" )
+    {
+        // Slide a run of backslashes over every position of a 64-byte block
+        for( std::size_t pad = 0; pad < 70; ++pad )
+        {
+            const std::string text = "[\"" + std::string( pad, 'x' ) + "\\\\\\\"]\", 7]";
+            Json js = Parser::parse( text );
+
+            REQUIRE( js.size() == 2 );
+            REQUIRE( js[0].getAs<std::string>() == std::string( pad, 'x' ) + "\\\"]" );
+            REQUIRE( js[1].getAs<int>() == 7 );
+        }
+    }
+
+    SECTION( "Large Document" )
+    {
+        std::string text = "[";
+        for( int i = 0; i < 5000; ++i ) {
+            text += ( i ? ",{\"id\":" : "{\"id\":" ) + std::to_string( i ) + ",\"s\":\"a,b\\\"c\"}";
+        }
+        text += "]";
+
+        Json js = Parser::parse( text );
+        REQUIRE( js.size() == 5000 );
+        REQUIRE( js[4999]["id"].getAs<int>() == 4999 );
+        REQUIRE( js[123]["s"].getAs<std::string>() == "a,b\"c" );
+    }
+
+    SECTION( "Unterminated String & Stray Bytes" )
+    {
+        REQUIRE_THROWS_AS( Parser::parse( "[\"abc\\\"]" ), TinyJsonException );
+        REQUIRE_THROWS_AS( Parser::parse( "[1\"a\"]" ),    TinyJsonException );
+        REQUIRE_THROWS_AS( Parser::parse( "[\"a\"b]" ),    TinyJsonException );
+        REQUIRE_THROWS_AS( Parser::parse( "[\\]" ),        TinyJsonException );
+    }
+}
+
+// =============================================================================
+// [Test 11] In-Situ Parsing (ViewDocument & JsonView)
+// Verify zero-copy parsing over a caller-owned, mutable buffer.
+// =============================================================================
+TEST_CASE( "In-Situ Parsing", "[parser][insitu]" )
+{
+    SECTION( "Views Point Into The Buffer" )
+    {
+        char buf[] = "{ \"name\": \"TinyJson\", \"tags\": [ \"a\", \"b\" ], \"n\": -12, \"pi\": 3.5, \"ok\": true, \"none\": null }";
+        ViewDocument doc = Parser::parseInSitu( buf, sizeof( buf ) - 1 );
+        JsonView     js  = doc.root();
+
+        REQUIRE( js.isObject() );
+        REQUIRE( js.size() == 6 );
+
+        StringView name = js["name"].getAs<StringView>();
+        REQUIRE( name == "TinyJson" );
+        REQUIRE( name.data() >= buf );
+        REQUIRE( name.data() <  buf + sizeof( buf ) );
+        REQUIRE( name.data()[name.size()] == '\0' ); // closing quote replaced
+
+        REQUIRE( js["tags"].isArray() );
+        REQUIRE( js["tags"][1].getAs<std::string>() == "b" );
+        REQUIRE( js["n"].getAs<int>() == -12 );
+        REQUIRE_THAT( js["pi"].getAs<double>(), Catch::Matchers::WithinRel( 3.5, 0.0001 ) );
+        REQUIRE( js["ok"].getAs<bool>() == true );
+        REQUIRE( js["none"].isNull() );
+        REQUIRE( js.contains( "pi" ) );
+        REQUIRE_FALSE( js.contains( "missing" ) );
+    }
+
+    SECTION( "Escapes Are Decoded In Place" )
+    {
+        std::string text = "[ \"line\\nnext\", \"q\\\"\\\\\", \"\\u00e9\\ud83d\\ude00\" ]";
+        ViewDocument doc = Parser::parseInSitu( &text[0], text.size() );
+
+        REQUIRE( doc.root()[0].getAs<std::string>() == "line\nnext" );
+        REQUIRE( doc.root()[1].getAs<std::string>() == "q\"\\" );
+        REQUIRE( doc.root()[2].getAs<std::string>() == "\xC3\xA9\xF0\x9F\x98\x80" );
+    }
+
+    SECTION( "Iteration (Values & Items)" )
+    {
+        char buf[] = "{ \"a\": 1, \"b\": { \"x\": [ 1, 2 ] }, \"c\": 3 }";
+        ViewDocument doc = Parser::parseInSitu( buf, sizeof( buf ) - 1 );
+
+        std::string keys = "";
+        for( auto item : doc.root().items() ) {
+            keys += item.key().toString();
+        }
+        REQUIRE( keys == "abc" );
+        REQUIRE( doc.root().keys().size() == 3 );
+
+        int sum = 0;
+        for( JsonView v : doc.root()["b"]["x"] ) {
+            sum += v.getAs<int>();
+        }
+        REQUIRE( sum == 3 );
+        REQUIRE( doc.root()["c"].getAs<int>() == 3 ); // skips the nested subtree
+    }
+
+    SECTION( "Errors" )
+    {
+        char bad[] = "{ \"a\": [1, 2 }";
+        REQUIRE_THROWS_AS( Parser::parseInSitu( bad, sizeof( bad ) - 1 ), TinyJsonException );
+
+        char ok[] = "[1]";
+        ViewDocument doc = Parser::parseInSitu( ok, sizeof( ok ) - 1 );
+        REQUIRE_THROWS_AS( doc.root()[3],     TinyJsonException );
+        REQUIRE_THROWS_AS( doc.root()["key"], TinyJsonException );
+    }
+
+    SECTION( "Duplicate Keys Match Json" )
+    {
+        // The first position is kept with the last value, as in Json
+        char buf[] = "{\"a\": 1, \"b\": {\"x\": [1, 2]}, \"\\u0061\": {\"y\": 2, \"y\": 3}, \"c\": true, \"b\": null}";
+        const Json   js  = Parser::parse( std::string( buf ) );
+        ViewDocument doc = Parser::parseInSitu( buf, sizeof( buf ) - 1 );
+        JsonView     v   = doc.root();
+
+        REQUIRE( v.size() == 3 );
+        REQUIRE( v.size() == js.size() );
+        REQUIRE( v.keys() == js.keys() );
+        REQUIRE( v["a"]["y"].getAs<int>() == 3 );
+        REQUIRE( v["a"].size() == 1 );
+        REQUIRE( v["b"].isNull() );
+        REQUIRE( v["c"].getAs<bool>() );
+
+        std::size_t members = 0;
+        for( const auto& item : v.items() ) {
+            REQUIRE( item.key() == js.keys()[members] );
+            ++members;
+        }
+        REQUIRE( members == 3 );
+    }
+}
+
+// =============================================================================
+// [Test 12] File Source (Memory-Mapped parseFile)
+// =============================================================================
+TEST_CASE( "File Source", "[parser][file]" )
+{
+    const char* filename = "test_source.json";
+
+    SECTION( "Large File Round Trip" )
+    {
+        Json writeJs = JsonArray();
+        for( int i = 0; i < 20000; ++i ) {
+            writeJs.addObject( "id", i );
+        }
+        REQUIRE( writeJs.saveFile( filename ) == true );
+
+        Json readJs = Parser::parseFile( filename );
+        REQUIRE( readJs.size() == 20000 );
+        REQUIRE( readJs[19999]["id"].getAs<int>() == 19999 );
+
+        std::remove( filename );
+    }
+
+    SECTION( "Empty File Is Null" )
+    {
+        std::FILE* fp = std::fopen( filename, "wb" );
+        REQUIRE( fp != nullptr );
+        std::fclose( fp );
+
+        REQUIRE( Parser::parseFile( filename ).isNull() );
+
+        std::remove( filename );
+    }
+
+    SECTION( "Missing File" )
+    {
+        REQUIRE_THROWS_AS( Parser::parseFile( "no_such_file.json" ), TinyJsonException );
+    }
+}
+
+// =============================================================================
+// [Test 13] StreamParser (Incremental Push Parsing)
+// Verify that input split at arbitrary bytes parses like the whole text.
+// =============================================================================
+TEST_CASE( "StreamParser", "[parser][stream]" )
+{
+    const std::string text =
+        "{ \"name\": \"Tiny\\\"Json\", \"u\": \"\\u00e9\", \"list\": [ 1, -2.5e3, true, null, [] ],"
+        "  \"nested\": { \"deep\": { \"v\": 12345678 } }, \"empty\": {} }";
+
+    SECTION( "Byte-by-Byte Feed" )
+    {
+        StreamParser sp;
+        for( char c : text ) {
+            sp.feed( &c, 1 );
+        }
+        sp.finish();
+
+        REQUIRE( sp.hasValue() );
+        Json js = sp.next();
+        REQUIRE( js.toString() == Parser::parse( text ).toString() );
+        REQUIRE( js["name"].getAs<std::string>() == "Tiny\"Json" );
+        REQUIRE( js["nested"]["deep"]["v"].getAs<int>() == 12345678 );
+        REQUIRE_FALSE( sp.hasValue() );
+    }
+
+    SECTION( "Arbitrary Chunk Sizes" )
+    {
+        for( std::size_t chunk = 2; chunk < 17; ++chunk )
+        {
+            StreamParser sp;
+            for( std::size_t i = 0; i < text.size(); i += chunk ) {
+                sp.feed( text.substr( i, chunk ) );
+            }
+            sp.finish();
+            REQUIRE( sp.next().toString() == Parser::parse( text ).toString() );
+        }
+    }
+
+    SECTION( "Multiple Values (JSON Lines) & Callback" )
+    {
+        std::vector<Json> values;
+        StreamParser sp( [&values]( Json&& v ) { values.push_back( std::move( v ) ); } );
+
+        sp.feed( "{\"id\":1}\n{\"id\"" );
+        REQUIRE( values.size() == 1 );
+
+        sp.feed( ":2}\n\"str\"\n4" );
+        REQUIRE( values.size() == 3 );
+
+        sp.feed( "2" );
+        sp.finish(); // a trailing number is only complete at end of input
+        REQUIRE( values.size() == 4 );
+
+        REQUIRE( values[1]["id"].getAs<int>() == 2 );
+        REQUIRE( values[2].getAs<std::string>() == "str" );
+        REQUIRE( values[3].getAs<int>() == 42 );
+    }
+
+    SECTION( "Errors" )
+    {
+        StreamParser sp;
+        REQUIRE_THROWS_AS( sp.feed( "[1, }" ), TinyJsonException );
+        REQUIRE_THROWS_AS( sp.feed( "[]" ),    TinyJsonException ); // stays failed
+
+        sp.reset();
+        sp.feed( "{\"a\": [1, 2" );
+        REQUIRE_THROWS_AS( sp.finish(), TinyJsonException );
+
+        sp.reset();
+        REQUIRE_THROWS_AS( sp.feed( "tru e" ),   TinyJsonException );
+        sp.reset();
+        REQUIRE_THROWS_AS( sp.feed( "[01]" ),    TinyJsonException );
+        sp.reset();
+        REQUIRE_THROWS_AS( sp.feed( "\"\\q\"" ), TinyJsonException );
+        sp.reset();
+        REQUIRE_THROWS_AS( sp.next(), TinyJsonException );
+    }
+
+    SECTION( "Moved-From Parser" )
+    {
+        StreamParser sp;
+        sp.feed( "[1, 2" );
+        StreamParser taken( std::move( sp ) );
+        taken.feed( "]" );
+        REQUIRE( taken.next().size() == 2 );
+
+        REQUIRE_THROWS_AS( sp.feed( "1 " ), TinyJsonException );
+        REQUIRE_THROWS_AS( sp.finish(),     TinyJsonException );
+        REQUIRE_THROWS_AS( sp.hasValue(),   TinyJsonException );
+        REQUIRE_THROWS_AS( sp.next(),       TinyJsonException );
+
+        sp.reset(); // usable again
+        sp.feed( "{\"a\": 1} " );
+        REQUIRE( sp.hasValue() );
+        REQUIRE( sp.next()["a"].getAs<int>() == 1 );
+    }
+}
+
+// =============================================================================
+// [Test 14] SAX Handler (Event Callbacks without a DOM)
+// Verify event order, decoded strings, int64/double split and early stop.
+// =============================================================================
+namespace {
+
+struct RecordingHandler : public JsonHandler
+{
+    std::vector<std::string> events;
+    int stopAfter = -1;
+
+    bool push( const std::string& e )
+    {
+        events.push_back( e );
+        return stopAfter < 0 || static_cast<int>( events.size() ) < stopAfter;
+    }
+
+    bool startObject() override            { return push( "{" ); }
+    bool key( StringView k ) override      { return push( "k:" + k.toString() ); }
+    bool endObject() override              { return push( "}" ); }
+    bool startArray() override             { return push( "[" ); }
+    bool endArray() override               { return push( "]" ); }
+    bool string( StringView s ) override   { return push( "s:" + s.toString() ); }
+    bool integer( int64_t i ) override     { return push( "i:" + std::to_string( i ) ); }
+    bool number( double d ) override       { return push( "d:" + std::to_string( d ) ); }
+    bool boolean( bool b ) override        { return push( b ? "true" : "false" ); }
+    bool null() override                   { return push( "null" ); }
+};
+
+} // namespace
+
+TEST_CASE( "SAX Handler", "[parser][sax]" )
+{
+    SECTION( "Event Order" )
+    {
+        RecordingHandler h;
+        REQUIRE( Parser::parse( "{\"a\": [1, 2.5, true, null], \"b\": {\"c\": \"x\"}}", h ) );
+
+        const std::vector<std::string> expected = {
+            "{", "k:a", "[", "i:1", "d:2.500000", "true", "null", "]",
+            "k:b", "{", "k:c", "s:x", "}", "}"
+        };
+        REQUIRE( h.events == expected );
+    }
+
+    SECTION( "Decoded Strings & Keys" )
+    {
+        RecordingHandler h;
+        REQUIRE( Parser::parse( "{\"t\\tab\": \"line\\n\\\"q\\\" \\u00e9\"}", h ) );
+        REQUIRE( h.events[1] == "k:t\tab" );
+        REQUIRE( h.events[2] == "s:line\n\"q\" \xC3\xA9" );
+    }
+
+    SECTION( "Integer Range" )
+    {
+        RecordingHandler h;
+        REQUIRE( Parser::parse( "[9223372036854775807, -9223372036854775808, 9223372036854775808, 1e2]", h ) );
+        REQUIRE( h.events[1] == "i:9223372036854775807" );
+        REQUIRE( h.events[2] == "i:-9223372036854775808" );
+        REQUIRE( h.events[3].compare( 0, 2, "d:" ) == 0 ); // overflows int64
+        REQUIRE( h.events[4] == "d:100.000000" );
+    }
+
+    SECTION( "Early Stop" )
+    {
+        RecordingHandler h;
+        h.stopAfter = 3;
+        REQUIRE_FALSE( Parser::parse( "[1, 2, 3, 4, 5]", h ) );
+        REQUIRE( h.events.size() == 3 );
+
+        // The default handler accepts everything
+        JsonHandler ignore;
+        REQUIRE( Parser::parse( "[1, {\"a\": \"b\"}]", ignore ) );
+    }
+
+    SECTION( "Errors" )
+    {
+        RecordingHandler h;
+        REQUIRE_THROWS_AS( Parser::parse( "[1, 2", h ), TinyJsonException );
+        REQUIRE_THROWS_AS( Parser::parse( "{\"a\" 1}", h ), TinyJsonException );
+    }
+
+    SECTION( "Handler Exceptions Propagate Unchanged" )
+    {
+        struct Throwing : JsonHandler {
+            bool integer( int64_t i ) override {
+                if( i == 2 ) throw std::runtime_error( "handler failed" );
+                return true;
+            }
+            bool string( StringView ) override { throw std::bad_alloc(); }
+        } h;
+
+        try {
+            Parser::parse( "[1, 2, 3]", h );
+            FAIL( "expected an exception" );
+        } catch( const TinyJsonException& ) {
+            FAIL( "handler error reported as a parse error" );
+        } catch( const std::runtime_error& e ) {
+            REQUIRE( std::string( e.what() ) == "handler failed" );
+        }
+        REQUIRE_THROWS_AS( Parser::parse( "[\"s\"]", h ), std::bad_alloc );
+    }
+}
+
+// =============================================================================
+// [Test 15] JSON Lines (Parallel parseLines)
+// Verify input order across many batches, blank lines, and error line numbers.
+// =============================================================================
+TEST_CASE( "JSON Lines", "[parser][lines]" )
+{
+    // ~600 KB: several batches per worker
+    std::string text;
+    const int count = 20000;
+    for( int i = 0; i < count; ++i ) {
+        text += "{\"id\": " + std::to_string( i ) + ", \"name\": \"user_" + std::to_string( i ) + "\"}";
+        text += ( i % 3 == 0 ) ? "\r\n" : "\n";
+    }
+
+    SECTION( "Buffer: Input Order" )
+    {
+        std::vector<Json> values = Parser::parseLines( text, 4 );
+        REQUIRE( values.size() == static_cast<std::size_t>( count ) );
+        bool ordered = true;
+        for( int i = 0; i < count; ++i ) {
+            ordered = ordered && values[i]["id"].getAs<int>() == i;
+        }
+        REQUIRE( ordered );
+        REQUIRE( values[count - 1]["name"].getAs<std::string>() == "user_" + std::to_string( count - 1 ) );
+    }
+
+    SECTION( "Stream & Callback" )
+    {
+        std::istringstream in( text );
+        int next = 0;
+        bool ordered = true;
+        Parser::parseLines( in, [&]( Json&& v ) {
+            ordered = ordered && v["id"].getAs<int>() == next;
+            ++next;
+        }, 3 );
+        REQUIRE( ordered );
+        REQUIRE( next == count );
+    }
+
+    SECTION( "File" )
+    {
+        const std::string fileName = "lines_test.ndjson";
+        {
+            std::ofstream ofs( fileName, std::ios::binary );
+            ofs << text;
+        }
+        std::vector<Json> values = Parser::parseLinesFile( fileName );
+        std::remove( fileName.c_str() );
+        REQUIRE( values.size() == static_cast<std::size_t>( count ) );
+        REQUIRE( values[1234]["id"].getAs<int>() == 1234 );
+
+        REQUIRE_THROWS_AS( Parser::parseLinesFile( "no_such_file.ndjson" ), TinyJsonException );
+    }
+
+    SECTION( "Blank Lines & Scalars" )
+    {
+        std::vector<Json> values = Parser::parseLines( "\n  \n1\n\"two\"\n\n[3]\n   \ntrue", 2 );
+        REQUIRE( values.size() == 4 );
+        REQUIRE( values[0].getAs<int>() == 1 );
+        REQUIRE( values[1].getAs<std::string>() == "two" );
+        REQUIRE( values[2][0].getAs<int>() == 3 );
+        REQUIRE( values[3].getAs<bool>() == true );
+
+        REQUIRE( Parser::parseLines( "", 2 ).empty() );
+    }
+
+    SECTION( "Error Line Number" )
+    {
+        std::string bad = text;
+        // Break the record on line 15001 (lines are 1-based)
+        std::size_t pos = 0;
+        for( int i = 0; i < 15000; ++i ) pos = bad.find( '\n', pos ) + 1;
+        bad.insert( pos, "}" );
+
+        try {
+            Parser::parseLines( bad, 4 );
+            FAIL( "expected TinyJsonException" );
+        }
+        catch( const TinyJsonException& e ) {
+            REQUIRE( std::string( e.what() ).find( "Line 15001:" ) == 0 );
+        }
+
+        // Records before the bad line are still delivered, in order
+        int delivered = 0;
+        REQUIRE_THROWS_AS( Parser::parseLines( StringView( bad.data(), bad.size() ), [&]( Json&& ) { ++delivered; }, 4 ), TinyJsonException );
+        REQUIRE( delivered == 15000 );
+    }
+}
+
+// =============================================================================
+// [Test 16] Lazy DOM (parseLazy)
+// Verify that lazily built trees read, iterate and modify like eager ones.
+// =============================================================================
+TEST_CASE( "Lazy DOM", "[parser][lazy]" )
+{
+    const std::string text =
+        "{ \"id\": 7, \"name\": \"a \\\"}]\\\" b\", \"pi\": -3.5e0, \"ok\": true, \"none\": null,"
+        "  \"list\": [ 1, [], {}, [ [ 2 ], { \"k\": \"v\" } ], \"x\" ],"
+        "  \"meta\": { \"tags\": [ \"t1\", \"t2\" ], \"deep\": { \"n\": 42 } },"
+        "  \"id\": 8 }";
+
+    SECTION( "Same Tree as Parser::parse" )
+    {
+        const Json lazy  = Parser::parseLazy( text );
+        const Json eager = Parser::parse( text );
+        REQUIRE( lazy.toString() == eager.toString() );
+        REQUIRE( lazy.toString( ToStringType::Pretty ) == eager.toString( ToStringType::Pretty ) );
+    }
+
+    SECTION( "Field Access" )
+    {
+        Json js = Parser::parseLazy( text.data(), text.size() );
+        REQUIRE( js.isObject() );
+        REQUIRE( js["id"].getAs<int>() == 8 ); // duplicate key overwrites
+        REQUIRE( js["name"].getAs<std::string>() == "a \"}]\" b" );
+        REQUIRE( js["pi"].isDouble() );
+        REQUIRE( js["ok"].getAs<bool>() == true );
+        REQUIRE( js["none"].isNull() );
+
+        REQUIRE( js["meta"]["deep"]["n"].getAs<int>() == 42 );
+        REQUIRE( js["list"].size() == 5 );
+        REQUIRE( js["list"][1].size() == 0 );
+        REQUIRE( js["list"][3][0][0].getAs<int>() == 2 );
+        REQUIRE( js["list"][3][1]["k"].getAs<std::string>() == "v" );
+        REQUIRE( js["list"][4].getAs<std::string>() == "x" );
+        REQUIRE( js.keys().size() == 7 );
+        REQUIRE( js.contains( "meta" ) );
+    }
+
+    SECTION( "Const Access & Iteration" )
+    {
+        const Json js = Parser::parseLazy( text );
+        std::vector<std::string> tags;
+        for( const auto& t : js["meta"]["tags"] ) {
+            tags.push_back( t.getAs<std::string>() );
+        }
+        REQUIRE( tags == std::vector<std::string>{ "t1", "t2" } );
+
+        int count = 0;
+        for( auto item : js["meta"].items() ) {
+            REQUIRE( item.value().isObject() == ( item.key() == "deep" ) );
+            ++count;
+        }
+        REQUIRE( count == 2 );
+        REQUIRE_THROWS_AS( js["missing"], TinyJsonException );
+    }
+
+    SECTION( "Copies & Modification" )
+    {
+        Json js   = Parser::parseLazy( text );
+        Json meta = js["meta"]; // copy of a still-lazy subtree
+        meta["deep"]["n"] = 1;
+        REQUIRE( meta["deep"]["n"].getAs<int>() == 1 );
+        REQUIRE( js["meta"]["deep"]["n"].getAs<int>() == 42 );
+
+        js["list"].addElementToArray( 9 );
+        REQUIRE( js["list"].size() == 6 );
+        REQUIRE( js["list"][5].getAs<int>() == 9 );
+
+        js["meta"] = 5; // replaces an unread subtree
+        REQUIRE( js["meta"].getAs<int>() == 5 );
+    }
+
+    SECTION( "Scalars & Errors" )
+    {
+        REQUIRE( Parser::parseLazy( "\"str\"" ).getAs<std::string>() == "str" );
+        REQUIRE( Parser::parseLazy( " 12 " ).getAs<int>() == 12 );
+        REQUIRE( Parser::parseLazy( "[]" ).size() == 0 );
+
+        // The whole text is validated up front, not when a subtree is read
+        REQUIRE_THROWS_AS( Parser::parseLazy( "{ \"a\": 1, \"b\": [ 1, 2, }" ), TinyJsonException );
+        REQUIRE_THROWS_AS( Parser::parseLazy( "[ { \"a\" 1 } ]" ), TinyJsonException );
+    }
+}
+
+// =============================================================================
+// [Test 17] Parallel Top-Level Array (parseParallel)
+// Verify that split-and-stitch parsing matches Parser::parse exactly.
+// =============================================================================
+TEST_CASE( "Parallel Array", "[parser][parallel]" )
+{
+    // ~3 MB: above the split threshold, many chunks per worker. Strings hold
+    // brackets and commas that the splitter must ignore.
+    std::string text = "\n[ ";
+    const int count = 30000;
+    for( int i = 0; i < count; ++i ) {
+        if( i > 0 ) text += ",\n  ";
+        text += "{ \"id\": " + std::to_string( i ) + ", \"s\": \"a,]}\\\\\\\"[{\", \"v\": [ " + std::to_string( i % 7 )
+              + ", { \"x\": null } ], \"pad\": \"" + std::string( 40, 'p' ) + "\" }";
+    }
+    text += " ]\n";
+
+    SECTION( "Same Result as Parser::parse" )
+    {
+        const Json eager    = Parser::parse( text );
+        const Json parallel = Parser::parseParallel( text, 4 );
+        REQUIRE( parallel.size() == static_cast<std::size_t>( count ) );
+        REQUIRE( parallel.toString() == eager.toString() );
+        REQUIRE( parallel[count - 1]["id"].getAs<int>() == count - 1 );
+        REQUIRE( parallel[12345]["s"].getAs<std::string>() == "a,]}\\\"[{" );
+    }
+
+    SECTION( "File" )
+    {
+        const std::string fileName = "parallel_test.json";
+        {
+            std::ofstream ofs( fileName, std::ios::binary );
+            ofs << text;
+        }
+        Json js = Parser::parseFileParallel( fileName, 3 );
+        std::remove( fileName.c_str() );
+        REQUIRE( js.size() == static_cast<std::size_t>( count ) );
+        REQUIRE( js[777]["v"][1]["x"].isNull() );
+    }
+
+    SECTION( "Fallbacks" )
+    {
+        REQUIRE( Parser::parseParallel( "[1, 2, 3]", 4 ).size() == 3 );       // small
+        REQUIRE( Parser::parseParallel( "{\"a\": [1]}", 4 )["a"][0].getAs<int>() == 1 );
+        REQUIRE( Parser::parseParallel( text, 1 ).size() == static_cast<std::size_t>( count ) );
+
+        const std::string empty = "[" + std::string( 2 << 20, ' ' ) + "]";
+        REQUIRE( Parser::parseParallel( empty, 4 ).size() == 0 );
+    }
+
+    SECTION( "Errors" )
+    {
+        // A malformed element deep inside one chunk
+        std::string bad = text;
+        bad.replace( bad.find( "\"id\": 20000," ), 12, "\"id\": 20000 " );
+        REQUIRE_THROWS_AS( Parser::parseParallel( bad, 4 ), TinyJsonException );
+
+        // Trailing comma, unbalanced brackets, trailing garbage
+        std::string trailing = text;
+        trailing.insert( trailing.rfind( ']' ), "," );
+        REQUIRE_THROWS_AS( Parser::parseParallel( trailing, 4 ), TinyJsonException );
+        REQUIRE_THROWS_AS( Parser::parseParallel( text.substr( 0, text.size() - 3 ), 4 ), TinyJsonException );
+        REQUIRE_THROWS_AS( Parser::parseParallel( text + "x", 4 ), TinyJsonException );
+    }
+}
+
+// =============================================================================
+// [Test 18] Native Numbers (int64 / uint64 / double storage)
+// Verify 64-bit integers, range checks and correctly rounded doubles.
+// =============================================================================
+TEST_CASE( "Native Numbers", "[json][number]" )
+{
+    SECTION( "64-bit Integers" )
+    {
+        Json js = Parser::parse( "[9223372036854775807, -9223372036854775808, 18446744073709551615, 4294967296]" );
+
+        REQUIRE( js[0].isInt() );
+        REQUIRE( js[0].getAs<long long>() == 9223372036854775807LL );
+        REQUIRE( js[1].getAs<long long>() == -9223372036854775807LL - 1 );
+        REQUIRE( js[2].getAs<unsigned long long>() == 18446744073709551615ULL );
+        REQUIRE( js[3].getAs<long long>() == 4294967296LL );
+        REQUIRE( js[3].getAs<double>() == 4294967296.0 );
+
+        // No more silent truncation or zeroing
+        REQUIRE_THROWS_AS( js[3].getAs<int>(), TinyJsonException );
+        REQUIRE_THROWS_AS( js[2].getAs<long long>(), TinyJsonException );
+        REQUIRE_THROWS_AS( js[1].getAs<unsigned long long>(), TinyJsonException );
+
+        int small = 0;
+        REQUIRE_FALSE( js[3].tryGetAs<int>( small ) );
+        long long big = 0;
+        REQUIRE( js[3].tryGetAs<long long>( big ) );
+        REQUIRE( big == 4294967296LL );
+    }
+
+    SECTION( "Beyond 64 Bits" )
+    {
+        Json js = Parser::parse( "123456789012345678901234567890" );
+        REQUIRE( js.isInt() );
+        REQUIRE( js.getAs<double>() == 123456789012345678901234567890.0 );
+        REQUIRE_THROWS_AS( js.getAs<long long>(), TinyJsonException );
+    }
+
+    SECTION( "Correctly Rounded Doubles" )
+    {
+        const char* cases[] = {
+            "0.1", "-2.5e-3", "1e23", "8.41e21", "3.14159265358979323846264338327950288",
+            "2.2250738585072011e-308", "4.9406564584124654e-324", "1.7976931348623157e308",
+            "9007199254740993.0", "0.000000000000000000000000000000000000001", "123.456e-310"
+        };
+        for( const char* text : cases ) {
+            Json js = Parser::parse( text );
+            REQUIRE( js.getAs<double>() == std::strtod( text, nullptr ) );
+            REQUIRE( Parser::parseLazy( std::string( "[" ) + text + "]" )[0].getAs<double>() == std::strtod( text, nullptr ) );
+        }
+    }
+
+    SECTION( "Beyond The Double Range" )
+    {
+        // Kept as text, like integers beyond 64 bits: written back unchanged
+        const double inf = std::numeric_limits<double>::infinity();
+        Json js = Parser::parse( "[1e400, -2.5E+999, 1e308]" );
+
+        REQUIRE( js[0].isDouble() );
+        REQUIRE( js[0].getAs<double>() == inf );
+        REQUIRE( js[1].getAs<double>() == -inf );
+        REQUIRE( js[2].getAs<double>() == 1e308 );
+        REQUIRE( js.toString() == "[ 1e400, -2.5E+999, 1e+308 ]" );
+        REQUIRE_THROWS_AS( js[0].getAs<long long>(), TinyJsonException );
+
+        Json copy = js;
+        copy.addElementToArray( 1 );
+        REQUIRE( copy[0].toString() == "1e400" );
+
+        REQUIRE( Parser::parseLazy( "[1e400]" ).toString() == "[ 1e400 ]" );
+
+        TapeDocument tape = Parser::parseTape( "[1e400, 2]" );
+        REQUIRE( tape.root()[0].isDouble() );
+        REQUIRE( tape.root()[0].getAs<double>() == inf );
+        REQUIRE( tape.root().toString() == "[ 1e400, 2 ]" );
+    }
+
+    SECTION( "Doubles to Integers" )
+    {
+        REQUIRE( Parser::parse( "3.7" ).getAs<int>() == 3 );
+        REQUIRE( Parser::parse( "-3.7" ).getAs<int>() == -3 );
+        REQUIRE( Parser::parse( "1e2" ).getAs<unsigned int>() == 100u );
+        REQUIRE_THROWS_AS( Parser::parse( "1e10" ).getAs<int>(), TinyJsonException );
+    }
+
+    SECTION( "Views Apply The Same Ranges" )
+    {
+        char buf[] = "[2147483647, -2147483648, 3000000000, -3.7, 1e300, 1e10, \"99999999999\"]";
+        ViewDocument doc = Parser::parseInSitu( buf, sizeof( buf ) - 1 );
+        JsonView js = doc.root();
+
+        REQUIRE( js[0].getAs<int>() == 2147483647 );
+        REQUIRE( js[1].getAs<int>() == -2147483647 - 1 );
+        REQUIRE( js[3].getAs<int>() == -3 );
+        REQUIRE_THROWS_AS( js[2].getAs<int>(), TinyJsonException );
+        REQUIRE_THROWS_AS( js[4].getAs<int>(), TinyJsonException );
+        REQUIRE_THROWS_AS( js[5].getAs<int>(), TinyJsonException );
+        REQUIRE( js[6].getAs<int>() == 0 );
+
+        int v = 0;
+        REQUIRE( js[0].tryGetAs<int>( v ) );
+        REQUIRE( v == 2147483647 );
+        REQUIRE_FALSE( js[2].tryGetAs<int>( v ) );
+        REQUIRE( v == 2147483647 );
+    }
+
+    SECTION( "Constructors & Assignment" )
+    {
+        REQUIRE( Json( 5000000000LL ).getAs<long long>() == 5000000000LL );
+        REQUIRE( Json( 18446744073709551615ULL ).getAs<unsigned long long>() == 18446744073709551615ULL );
+        REQUIRE( Json( 7u ).isInt() );
+        REQUIRE( Json( 2.5 ).getAs<double>() == 2.5 );
+
+        Json js = JsonObject();
+        js["l"]  = 1L << 40;
+        js["u"]  = 3000000000u;
+        js["ll"] = -5LL;
+        js["d"]  = 0.25;
+        REQUIRE( js["l"].getAs<long long>() == ( 1LL << 40 ) );
+        REQUIRE( js["u"].getAs<unsigned int>() == 3000000000u );
+        REQUIRE( js["ll"].getAs<int>() == -5 );
+        REQUIRE( js["d"].getAs<double>() == 0.25 );
+        REQUIRE( js.toString() == Parser::parse( js.toString() ).toString() );
+    }
+
+    SECTION( "Strings Keep Text Conversion" )
+    {
+        Json js = Parser::parse( "[\"42\", \"2.5\", \"x\"]" );
+        REQUIRE( js[0].getAs<int>() == 42 );
+        REQUIRE( js[1].getAs<double>() == 2.5 );
+        REQUIRE( js[2].getAs<int>() == 0 );
+    }
+}
+
+// =============================================================================
+// [Test 19] Number Formatting (Shortest Round-Trip)
+// Verify that serialized numbers are short and read back to the same value.
+// =============================================================================
+TEST_CASE( "Number Formatting", "[json][number]" )
+{
+    SECTION( "Doubles" )
+    {
+        REQUIRE( Json( 0.1 ).toString()     == "0.1" );
+        REQUIRE( Json( 2.5 ).toString()     == "2.5" );
+        REQUIRE( Json( 2.0 ).toString()     == "2.0" ); // stays a double when parsed back
+        REQUIRE( Json( -0.0 ).toString()    == "-0.0" );
+        REQUIRE( Json( 1e21 ).toString()    == "1e+21" );
+        REQUIRE( Json( 1e20 ).toString()    == "100000000000000000000.0" );
+        REQUIRE( Json( 1e-7 ).toString()    == "1e-7" );
+        REQUIRE( Json( 0.000001 ).toString() == "0.000001" );
+        REQUIRE( Json( 5e-324 ).toString()  == "5e-324" );
+        REQUIRE( Json( 1.7976931348623157e308 ).toString() == "1.7976931348623157e+308" );
+        REQUIRE( Json( 0.1f ).toString()    == "0.1" ); // shortest for the float
+        REQUIRE( Json( 0.1f ).getAs<double>() == 0.1 );
+
+        Json js = JsonObject();
+        js["v"] = 1.0 / 3.0;
+        REQUIRE( js.toString() == "{ \"v\": 0.3333333333333333 }" );
+        REQUIRE( js["v"].getAs<std::string>() == "0.3333333333333333" );
+    }
+
+    SECTION( "Round Trip" )
+    {
+        const double values[] = { 3.141592653589793, 1e-300, 123456.789e200, 9007199254740993.0,
+                                  0.30000000000000004, -2.2250738585072014e-308, 4.35e-7, 1e15 };
+        for( double v : values ) {
+            const std::string text = Json( v ).toString();
+            REQUIRE( Parser::parse( text ).getAs<double>() == v );
+            REQUIRE( Parser::parse( text ).isDouble() );
+        }
+    }
+
+    SECTION( "Integers" )
+    {
+        REQUIRE( Json( 0 ).toString() == "0" );
+        REQUIRE( Json( -7 ).toString() == "-7" );
+        REQUIRE( Json( -9223372036854775807LL - 1 ).toString() == "-9223372036854775808" );
+        REQUIRE( Json( 18446744073709551615ULL ).toString() == "18446744073709551615" );
+        REQUIRE( Json( 1234567890 ).getAs<std::string>() == "1234567890" );
+    }
+
+    SECTION( "Parsed Numbers" )
+    {
+        Json js = Parser::parse( "[1.50, 1E3, -0, 100, 123456789012345678901234567890]" );
+        REQUIRE( js.toString() == "[ 1.5, 1000.0, 0, 100, 123456789012345678901234567890 ]" );
+
+        // NaN and infinity have no JSON form
+        REQUIRE( Json( std::numeric_limits<double>::infinity() ).toString() == "null" );
+        REQUIRE( Json( std::nan( "" ) ).toString() == "null" );
+    }
+}
+
+// =============================================================================
+// [Test 20] String Escaping
+// Verify that strings are decoded once on parse and re-escaped on output.
+// =============================================================================
+TEST_CASE( "String Escaping", "[json][string]" )
+{
+    SECTION( "Decoded On Parse" )
+    {
+        Json js = Parser::parse( "{ \"k\\\"ey\": \"a\\/b\\n\\u00e9\\ud83d\\ude00\\ud800x\" }" );
+        REQUIRE( js.contains( "k\"ey" ) );
+        REQUIRE( js["k\"ey"].getAs<std::string>() == "a/b\n\xC3\xA9\xF0\x9F\x98\x80\xEF\xBF\xBDx" );
+
+        Json lazy = Parser::parseLazy( "[ { \"t\\tab\": \"q\\\"\" } ]" );
+        REQUIRE( lazy[0]["t\tab"].getAs<std::string>() == "q\"" );
+    }
+
+    SECTION( "Escaped On Output" )
+    {
+        Json js = JsonObject();
+        js["q\"k"] = std::string( "tab\t nl\n quote\" bs\\ ctl\x01 \xC3\xA9" );
+        REQUIRE( js.toString() == "{ \"q\\\"k\": \"tab\\t nl\\n quote\\\" bs\\\\ ctl\\u0001 \xC3\xA9\" }" );
+        REQUIRE( Parser::parse( js.toString() )["q\"k"].getAs<std::string>() == js["q\"k"].getAs<std::string>() );
+    }
+
+    SECTION( "ASCII-Only Output" )
+    {
+        Json js = Json( std::string( "\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80 \xFF" ) );
+        REQUIRE( js.toString( ToStringType::Strip, true ) == "\"\\u00e9\\u20ac\\ud83d\\ude00 \\ufffd\"" );
+        REQUIRE( Parser::parse( Json( std::string( "\xC3\xA9" ) ).toString( ToStringType::Pretty, true ) )
+                     .getAs<std::string>() == "\xC3\xA9" );
+    }
+
+    SECTION( "Long Strings" )
+    {
+        // Special bytes at every position of the vectorized blocks
+        bool same = true;
+        for( std::size_t pos = 0; pos < 70; ++pos ) {
+            std::string s( 70, 'x' );
+            s[pos] = ( pos % 2 ) ? '"' : '\n';
+            const Json back = Parser::parse( Json( s ).toString() );
+            same = same && back.getAs<std::string>() == s;
+        }
+        REQUIRE( same );
+    }
+}
+
+// =============================================================================
+// [Test 21] UTF-8 Validation
+// Verify that ParseOptions::validateUtf8 rejects malformed input with its offset.
+// =============================================================================
+TEST_CASE( "UTF-8 Validation", "[parser][utf8]" )
+{
+    ParseOptions strict;
+    strict.validateUtf8 = true;
+
+    SECTION( "Valid Input" )
+    {
+        const std::string text = "{ \"k\xC3\xA9y\": \"\xE2\x82\xAC \xF0\x9F\x98\x80 \xF4\x8F\xBF\xBF\" }";
+        REQUIRE( Parser::parse( text, strict ).toString() == Parser::parse( text ).toString() );
+
+        // Multi-byte characters across the 64-byte block boundaries
+        std::string longText = "\"";
+        for( int i = 0; i < 100; ++i ) longText += "ab\xE2\x82\xAC";
+        longText += "\"";
+        REQUIRE( Parser::parse( longText, strict ).getAs<std::string>() == longText.substr( 1, longText.size() - 2 ) );
+    }
+
+    SECTION( "Malformed Input" )
+    {
+        const char* bad[] = {
+            "\"\xC3\"",             // truncated
+            "\"\xC0\xAF\"",         // overlong
+            "\"\xED\xA0\x80\"",     // surrogate
+            "\"\xF4\x90\x80\x80\"", // above U+10FFFF
+            "\"\xFF\"",
+            "\"\x80\""
+        };
+        for( const char* text : bad ) {
+            REQUIRE_THROWS_AS( Parser::parse( text, strict ), TinyJsonException );
+        }
+        REQUIRE_NOTHROW( Parser::parse( "\"\xFF\"" ) ); // unchecked by default
+
+        std::string text( 70, ' ' );
+        text += "\"\xE2\x82\"";
+        try {
+            Parser::parse( text, strict );
+            FAIL( "expected an exception" );
+        } catch( const TinyJsonException& e ) {
+            REQUIRE( std::string( e.what() ).find( "Invalid UTF-8 (at offset 71)" ) != std::string::npos );
+        }
+    }
+
+    SECTION( "Every Entry Point" )
+    {
+        const std::string bad = "[\"ok\", \"\xE2\x82\"]";
+
+        JsonHandler ignore;
+        REQUIRE( Parser::parse( bad, ignore ) );
+        REQUIRE_THROWS_AS( Parser::parse( bad, ignore, strict ), TinyJsonException );
+
+        std::string buf = bad;
+        REQUIRE_THROWS_AS( Parser::parseInSitu( &buf[0], buf.size(), strict ), TinyJsonException );
+        REQUIRE_THROWS_AS( Parser::parseLazy( bad, strict ), TinyJsonException );
+        REQUIRE_THROWS_AS( Parser::parseLines( "1\n" + bad + "\n", 2, strict ), TinyJsonException );
+
+        // Split inside the string: checked once the string is complete
+        StreamParser sp( strict );
+        sp.feed( bad.substr( 0, 10 ) );
+        try {
+            sp.feed( bad.substr( 10 ) );
+            FAIL( "expected an exception" );
+        } catch( const TinyJsonException& e ) {
+            REQUIRE( std::string( e.what() ).find( "Invalid UTF-8 (at offset 8)" ) != std::string::npos );
+        }
+
+        std::string big = "[";
+        for( int i = 0; i < 300000; ++i ) big += "\"\xC3\xA9\",";
+        REQUIRE( Parser::parseParallel( big + "1]", 4, strict ).size() == 300001 );
+        REQUIRE_THROWS_AS( Parser::parseParallel( big + bad + "]", 4, strict ), TinyJsonException );
+    }
+}
+
+// =============================================================================
+// [Test 22] Nesting Depth
+// Verify that deep documents parse without recursion up to ParseOptions::maxDepth.
+// =============================================================================
+TEST_CASE( "Nesting Depth", "[parser][depth]" )
+{
+    auto nested = []( std::size_t depth ) {
+        return std::string( depth, '[' ) + "1" + std::string( depth, ']' );
+    };
+
+    SECTION( "Default Limit" )
+    {
+        Json js = Parser::parse( nested( 1024 ) );
+        REQUIRE( js.isArray() );
+        REQUIRE_THROWS_AS( Parser::parse( nested( 1025 ) ), TinyJsonException );
+
+        // A hostile payload fails fast instead of exhausting the stack
+        REQUIRE_THROWS_AS( Parser::parse( std::string( 1000000, '[' ) ), TinyJsonException );
+
+        StreamParser sp;
+        REQUIRE_THROWS_AS( sp.feed( nested( 1025 ) ), TinyJsonException );
+    }
+
+    SECTION( "Configured Limit" )
+    {
+        ParseOptions shallow;
+        shallow.maxDepth = 2;
+        REQUIRE( Parser::parse( "{ \"a\": [ 1, 2 ], \"b\": {} }", shallow ).size() == 2 );
+        REQUIRE_THROWS_AS( Parser::parse( "{ \"a\": [ [ 1 ] ] }", shallow ), TinyJsonException );
+
+        ParseOptions deep;
+        deep.maxDepth = 100000;
+        REQUIRE( Parser::parse( nested( 5000 ), deep ).size() == 1 );
+    }
+
+    SECTION( "Every Entry Point" )
+    {
+        ParseOptions shallow;
+        shallow.maxDepth = 2;
+        const std::string ok = nested( 2 ), deep = nested( 3 );
+
+        JsonHandler ignore;
+        REQUIRE( Parser::parse( ok, ignore, shallow ) );
+        REQUIRE_THROWS_AS( Parser::parse( deep, ignore, shallow ), TinyJsonException );
+
+        std::string buf = deep;
+        REQUIRE_THROWS_AS( Parser::parseInSitu( &buf[0], buf.size(), shallow ), TinyJsonException );
+        REQUIRE_THROWS_AS( Parser::parseLazy( deep, shallow ), TinyJsonException );
+        REQUIRE_THROWS_AS( Parser::parseTape( deep, shallow ), TinyJsonException );
+        REQUIRE( Parser::parseLazy( ok, shallow ).size() == 1 );
+
+        REQUIRE( Parser::parseLines( ok + "\n" + ok + "\n", 2, shallow ).size() == 2 );
+        REQUIRE_THROWS_AS( Parser::parseLines( ok + "\n" + deep + "\n", 2, shallow ), TinyJsonException );
+
+        StreamParser sp( shallow );
+        sp.feed( ok );
+        REQUIRE( sp.next().size() == 1 );
+        REQUIRE_THROWS_AS( sp.feed( deep ), TinyJsonException );
+        sp.reset(); // keeps the options
+        REQUIRE_THROWS_AS( sp.feed( deep ), TinyJsonException );
+
+        // Large enough to be split across threads: the limit still counts
+        // the root array
+        std::string big = "[";
+        for( int i = 0; i < 300000; ++i ) big += "[1],";
+        REQUIRE( Parser::parseParallel( big + "[2]]", 4, shallow ).size() == 300001 );
+        REQUIRE_THROWS_AS( Parser::parseParallel( big + "[[2]]]", 4, shallow ), TinyJsonException );
+    }
+}
+
+// =============================================================================
+// [Test 23] Exception-Free Parsing
+// Verify that tryParse reports error codes with offset, line and column.
+// =============================================================================
+TEST_CASE( "Exception-Free Parsing", "[parser][error]" )
+{
+    SECTION( "Success" )
+    {
+        Json out = JsonNULL();
+        const ParseResult r = Parser::tryParse( "{ \"a\": [ 1, 2 ] }", out );
+        REQUIRE( r );
+        REQUIRE( r.error == ParseError::None );
+        REQUIRE( out["a"][1].getAs<int>() == 2 );
+    }
+
+    SECTION( "Error Location" )
+    {
+        Json out = Json( "unchanged" );
+        const ParseResult r = Parser::tryParse( "{\n  \"a\": 1,\n  \"b\": tru\n}", out );
+        REQUIRE_FALSE( r );
+        REQUIRE( r.error == ParseError::InvalidCharacter );
+        REQUIRE( r.offset == 19 );
+        REQUIRE( r.line == 3 );
+        REQUIRE( r.column == 8 );
+        REQUIRE( std::string( r.message() ) == "Invalid character in JSON" );
+        REQUIRE( out.getAs<std::string>() == "unchanged" );
+    }
+
+    SECTION( "Error Codes" )
+    {
+        Json out = JsonNULL();
+        REQUIRE( Parser::tryParse( "[1, 2", out ).error == ParseError::MismatchedBrackets );
+        REQUIRE( Parser::tryParse( "[1 2]", out ).error == ParseError::ExpectedArrayEnd );
+        REQUIRE( Parser::tryParse( "{\"a\" 1}", out ).error == ParseError::ExpectedColon );
+        REQUIRE( Parser::tryParse( "\"abc", out ).error == ParseError::UnterminatedString );
+        REQUIRE( Parser::tryParse( "01", out ).error == ParseError::LeadingZero );
+        REQUIRE( Parser::tryParse( "1 2", out ).error == ParseError::TrailingCharacters );
+        REQUIRE( Parser::tryParse( "\"\\x\"", out ).error == ParseError::InvalidEscape );
+
+        ParseOptions shallow;
+        shallow.maxDepth = 1;
+        const ParseResult deep = Parser::tryParse( "[[1]]", out, shallow );
+        REQUIRE( deep.error == ParseError::DepthExceeded );
+        REQUIRE( deep.column == 2 );
+
+        // A tape over its 32-bit limits is not reported as running out of memory
+        REQUIRE( std::string( ParseResult{ ParseError::DocumentTooLarge }.message() )
+                 != ParseResult{ ParseError::OutOfMemory }.message() );
+    }
+
+    SECTION( "Same Message As parse()" )
+    {
+        try {
+            Parser::parse( "[1, }" );
+            FAIL( "expected an exception" );
+        } catch( const TinyJsonException& e ) {
+            REQUIRE( std::string( e.what() ) == "Parse Error: Invalid character in JSON (at offset 4)" );
+        }
+    }
+}
+
+// =============================================================================
+// [Test 24] String Assignment & Validation
+// Verify the explicit assign APIs and the allocation-free Parser::isObject.
+// =============================================================================
+TEST_CASE( "String Assignment", "[json][assign]" )
+{
+    SECTION( "operator= Sniffs JSON Text" )
+    {
+        Json js = JsonObject();
+        js["obj"]   = "{\"a\": 1}";
+        js["num"]   = "123";
+        js["text"]  = "hello world";
+        js["blank"] = "  ";
+        js["bad"]   = "[1, 2";
+        REQUIRE( js["obj"]["a"].getAs<int>() == 1 );
+        REQUIRE( js["num"].isInt() );
+        REQUIRE( js["text"].getAs<std::string>() == "hello world" );
+        REQUIRE( js["blank"].isString() );
+        REQUIRE( js["bad"].getAs<std::string>() == "[1, 2" );
+    }
+
+    SECTION( "Explicit Assignment" )
+    {
+        Json js = JsonObject();
+        js["raw"].assignString( "{\"a\": 1}" );
+        REQUIRE( js["raw"].isString() );
+        REQUIRE( js["raw"].getAs<std::string>() == "{\"a\": 1}" );
+
+        // Any text: a std::string, or part of a buffer
+        const std::string line = "id=42;name=kim";
+        js["id"].assignString( StringView( line.data() + 3, 2 ) );
+        js["line"].assignString( line );
+        REQUIRE( js["id"].getAs<std::string>() == "42" );
+        REQUIRE( js["line"].getAs<std::string>() == line );
+
+        js["arr"].assignJson( "[1, 2, 3]" ).addElementToArray( 4 );
+        REQUIRE( js["arr"].size() == 4 );
+
+        Json keep = Json( 7 );
+        REQUIRE_THROWS_AS( keep.assignJson( "[1, " ), TinyJsonException );
+        REQUIRE( keep.getAs<int>() == 7 );
+    }
+
+    SECTION( "isObject" )
+    {
+        REQUIRE( Parser::isObject( "{ \"a\": [ 1, \"x\\\"y\", null ] }" ) );
+        REQUIRE( Parser::isObject( " 12.5e3 " ) );
+        REQUIRE_FALSE( Parser::isObject( "" ) );
+        REQUIRE_FALSE( Parser::isObject( " \n " ) );
+        REQUIRE_FALSE( Parser::isObject( "{\"a\": 1,}" ) );
+        REQUIRE_FALSE( Parser::isObject( "[1] [2]" ) );
+        REQUIRE_FALSE( Parser::isObject( "\"\\q\"" ) );
+        REQUIRE_FALSE( Parser::isObject( std::string( 1025, '[' ) + std::string( 1025, ']' ) ) );
+        REQUIRE( Parser::isObject( std::string( 1024, '[' ) + std::string( 1024, ']' ) ) );
+    }
+}
+
+// =============================================================================
+// [Test 25] Node Layout
+// Verify the compact node keeps every value intact through copy and move.
+// =============================================================================
+TEST_CASE( "Node Layout", "[json][layout]" )
+{
+    SECTION( "Node Size" )
+    {
+        REQUIRE( sizeof( Json ) <= 16 );
+    }
+
+    SECTION( "Scalars Round-Trip" )
+    {
+        Json js = Parser::parse( "[true, false, null, \"s\", -7, 18446744073709551615, 1.5, 123456789012345678901234567890]" );
+        REQUIRE( js[0].getAs<bool>() );
+        REQUIRE_FALSE( js[1].getAs<bool>() );
+        REQUIRE( js[1].getAs<std::string>() == "false" );
+        REQUIRE( js[2].isNull() );
+        REQUIRE( js[2].getAs<std::string>() == "null" );
+        REQUIRE( js[3].getAs<std::string>() == "s" );
+        REQUIRE( js[4].getAs<long long>() == -7 );
+        REQUIRE( js[5].getAs<unsigned long long>() == 18446744073709551615ULL );
+        REQUIRE( js[6].getAs<double>() == 1.5 );
+        REQUIRE( js[7].getAs<double>() == 1.2345678901234568e29 );
+        REQUIRE_THROWS_AS( js[7].getAs<long long>(), TinyJsonException );
+        REQUIRE( js.toString() == "[ true, false, null, \"s\", -7, 18446744073709551615, 1.5, 123456789012345678901234567890 ]" );
+    }
+
+    SECTION( "Copy, Move & Retype" )
+    {
+        Json js   = Parser::parse( "{\"a\": {\"b\": [1, \"x\"]}, \"c\": 9}" );
+        Json copy = js;
+        copy["a"]["b"][1] = 2;
+        REQUIRE( js["a"]["b"][1].getAs<std::string>() == "x" );
+
+        Json moved = std::move( copy );
+        REQUIRE( moved["a"]["b"][1].getAs<int>() == 2 );
+
+        // A child moved over its own parent
+        moved = std::move( moved["a"] );
+        REQUIRE( moved.toString() == "{ \"b\": [ 1, 2 ] }" );
+
+        moved["b"] = "text";
+        moved["b"] = true;
+        REQUIRE( moved.toString() == "{ \"b\": true }" );
+    }
+
+    SECTION( "Scalars Iterate As Empty" )
+    {
+        const Json js = Json( 5 );
+        REQUIRE( js.begin() == js.end() );
+        REQUIRE( js.size() == 0 );
+    }
+}
+
+// =============================================================================
+// [Test 26] Arena Document
+// Verify Document parsing, bulk reset and reuse of one document.
+// =============================================================================
+TEST_CASE( "Arena Document", "[document]" )
+{
+    SECTION( "Parse & Read" )
+    {
+        Document doc;
+        JsonView root = doc.parse( "{ \"name\": \"caf\\u00e9\", \"list\": [1, 2.5, true, null], \"esc\": \"a\\\"b\" }" );
+        REQUIRE( root.isObject() );
+        REQUIRE( root["name"].getAs<std::string>() == "caf\xC3\xA9" );
+        REQUIRE( root["list"].size() == 4 );
+        REQUIRE( root["list"][1].getAs<double>() == 2.5 );
+        REQUIRE( root["list"][2].getAs<bool>() );
+        REQUIRE( root["esc"].getAs<StringView>() == StringView( "a\"b" ) );
+        REQUIRE( doc.memoryUsage() > 0 );
+    }
+
+    SECTION( "Input Is Copied" )
+    {
+        Document    doc;
+        std::string text = "[\"abc\"]";
+        doc.parse( text );
+        text = "[\"xyz\"]";
+        REQUIRE( doc.root()[0].getAs<std::string>() == "abc" );
+    }
+
+    SECTION( "Reset & Reuse" )
+    {
+        Document doc( 256 );
+        for( int i = 0; i < 3; ++i ) {
+            doc.parse( "[" + std::to_string( i ) + ", \"" + std::string( 1000, 'x' ) + "\"]" );
+            REQUIRE( doc.root()[0].getAs<int>() == i );
+            REQUIRE( doc.root()[1].getAs<StringView>().size() == 1000 );
+        }
+
+        doc.reset();
+        REQUIRE( doc.memoryUsage() == 0 );
+        REQUIRE_FALSE( doc.root().isValid() );
+    }
+
+    SECTION( "Errors Leave It Empty" )
+    {
+        Document doc;
+        doc.parse( "[1, 2]" );
+        REQUIRE_THROWS_AS( doc.parse( "[1, 2" ), TinyJsonException );
+        REQUIRE( doc.nodeCount() == 0 );
+
+        const ParseResult r = doc.tryParse( "{\"a\": }" );
+        REQUIRE( r.error == ParseError::InvalidCharacter );
+        REQUIRE( r.offset == 6 );
+
+        Document moved = std::move( doc );
+        REQUIRE( doc.parse( "true" ).getAs<bool>() );
+        REQUIRE( moved.tryParse( "null" ) );
+    }
+}
+
+// =============================================================================
+// [Test 27] String Interning
+// Verify that repeated keys share one buffer, within and across documents.
+// =============================================================================
+TEST_CASE( "String Interning", "[json][intern]" )
+{
+    SECTION( "SharedString" )
+    {
+        SharedString a( "status" );
+        SharedString b = a;
+        SharedString c( "status" );
+        REQUIRE( a.sameAs( b ) );
+        REQUIRE_FALSE( a.sameAs( c ) );
+        REQUIRE( a == c );
+        REQUIRE( a.view() == StringView( "status" ) );
+        REQUIRE( SharedString().empty() );
+    }
+
+    SECTION( "StringPool" )
+    {
+        StringPool   pool;
+        SharedString a = pool.intern( "currency" );
+        SharedString b = pool.intern( std::string( "currency" ) );
+        REQUIRE( a.sameAs( b ) );
+        REQUIRE( pool.size() == 1 );
+
+        pool.clear();
+        REQUIRE( pool.size() == 0 );
+        REQUIRE( a.str() == "currency" ); // still owned by its users
+    }
+
+    SECTION( "Parse With A Shared Pool" )
+    {
+        StringPool   pool;
+        ParseOptions options;
+        options.pool              = &pool;
+        options.internValueLength = 8;
+
+        Json first  = Parser::parse( "[{\"id\": 1, \"state\": \"active\"}, {\"id\": 2, \"state\": \"active\"}]", options );
+        Json second = Parser::parse( "{\"id\": 3, \"state\": \"paused\", \"note\": \"longer than eight\"}", options );
+
+        REQUIRE( first[0]["id"].getAs<int>() == 1 );
+        REQUIRE( first[1]["state"].getAs<std::string>() == "active" );
+        REQUIRE( second["state"].getAs<std::string>() == "paused" );
+        REQUIRE( second["note"].getAs<std::string>() == "longer than eight" );
+
+        // id, state, active, paused, note: the long value is not interned
+        REQUIRE( pool.size() == 5 );
+        REQUIRE( pool.intern( "id" ).sameAs( pool.intern( "id" ) ) );
+    }
+
+    SECTION( "Keys Survive Copies And Edits" )
+    {
+        Json base = Parser::parse( "{\"name\": \"a\", \"tags\": [\"x\"]}" );
+        Json copy = base;
+        copy["name"] = "b";
+        copy["extra"] = 1;
+        REQUIRE( base["name"].getAs<std::string>() == "a" );
+        REQUIRE( copy.keys() == std::vector<std::string>{ "name", "tags", "extra" } );
+        REQUIRE( copy.toString() == "{ \"name\": \"b\", \"tags\": [ \"x\" ], \"extra\": 1 }" );
+    }
+}
+
+// =============================================================================
+// [Test 28] Object Lookup
+// Verify member lookup below and above the linear-scan threshold.
+// =============================================================================
+TEST_CASE( "Object Lookup", "[json][lookup]" )
+{
+    SECTION( "Small And Large Objects" )
+    {
+        for( int count : { 3, 8, 9, 100, 5000 } )
+        {
+            Json obj = JsonObject();
+            for( int i = 0; i < count; ++i ) obj["k" + std::to_string( i )] = i;
+
+            REQUIRE( obj.size() == static_cast<std::size_t>( count ) );
+            for( int i = 0; i < count; ++i ) REQUIRE( obj["k" + std::to_string( i )].getAs<int>() == i );
+            REQUIRE_FALSE( obj.contains( "k" + std::to_string( count ) ) );
+
+            const Json copy = obj;
+            REQUIRE( copy["k" + std::to_string( count - 1 )].getAs<int>() == count - 1 );
+            REQUIRE_FALSE( copy.contains( "missing" ) );
+        }
+    }
+
+    SECTION( "Duplicate Keys In Large Objects" )
+    {
+        std::string text = "{";
+        for( int i = 0; i < 50; ++i ) text += "\"k" + std::to_string( i ) + "\": " + std::to_string( i ) + ", ";
+        text += "\"k7\": \"last\", \"k42\": \"wins\" }";
+
+        Json js = Parser::parse( text );
+        REQUIRE( js.size() == 50 );
+        REQUIRE( js["k7"].getAs<std::string>() == "last" );
+        REQUIRE( js["k42"].getAs<std::string>() == "wins" );
+        REQUIRE( js.keys()[42] == "k42" );
+
+        Json lazy = Parser::parseLazy( text );
+        REQUIRE( lazy.size() == 50 );
+        REQUIRE( lazy["k42"].getAs<std::string>() == "wins" );
+    }
+}
+
+// =============================================================================
+// [Test 29] Copy-On-Write
+// Verify that copies share subtrees until one side modifies them.
+// =============================================================================
+TEST_CASE( "Copy-On-Write", "[json][cow]" )
+{
+    SECTION( "Copies Diverge On Write" )
+    {
+        const Json base = Parser::parse( "{\"user\": {\"name\": \"kim\", \"roles\": [\"a\", \"b\"]}, \"n\": 1}" );
+
+        Json copy = base;
+        copy["user"]["roles"][0] = "admin";
+        copy["user"]["roles"].addElementToArray( "c" );
+        copy["n"] = 2;
+
+        REQUIRE( base.toString() == "{ \"user\": { \"name\": \"kim\", \"roles\": [ \"a\", \"b\" ] }, \"n\": 1 }" );
+        REQUIRE( copy.toString() == "{ \"user\": { \"name\": \"kim\", \"roles\": [ \"admin\", \"b\", \"c\" ] }, \"n\": 2 }" );
+    }
+
+    SECTION( "Attached Subtrees Stay Independent" )
+    {
+        Json cached = JsonArray( 1, 2, 3 );
+        Json response = JsonObject();
+        response.addObject( "data", cached );
+        response["data"].addElementToArray( 4 );
+        cached.addElementToArray( 5 );
+
+        REQUIRE( response["data"].size() == 4 );
+        REQUIRE( cached.size() == 4 );
+        REQUIRE( cached[3].getAs<int>() == 5 );
+    }
+
+    SECTION( "Mutable Iteration Writes Only The Copy" )
+    {
+        const Json base = JsonArray( 1, 2, 3 );
+        Json       copy = base;
+        for( auto& v : copy ) v = v.getAs<int>() * 10;
+
+        REQUIRE( base.toString() == "[ 1, 2, 3 ]" );
+        REQUIRE( copy.toString() == "[ 10, 20, 30 ]" );
+    }
+
+    SECTION( "Reference Then Copy Then Write" )
+    {
+        Json  a = Parser::parse( "{\"x\": {\"v\": 1}}" );
+        Json& r = a["x"];
+        Json  c = a;
+        r["y"] = 5;
+
+        REQUIRE( a.toString() == "{ \"x\": { \"v\": 1, \"y\": 5 } }" );
+        REQUIRE( c.toString() == "{ \"x\": { \"v\": 1 } }" );
+
+        // Emplaced children are references into their container as well
+        Json  users = JsonArray();
+        Json& first = users.emplaceBack( JsonType::OBJECT );
+        Json  snap  = users;
+        first.emplace( "id", 1 );
+
+        REQUIRE( users.toString() == "[ { \"id\": 1 } ]" );
+        REQUIRE( snap.toString() == "[ {  } ]" );
+    }
+
+    SECTION( "Const Reference Outlives The Copy" )
+    {
+        // Only existing members are written, so no vector reallocates
+        Json        a = Parser::parse( "{\"x\": {\"v\": [1, 2], \"w\": 0}, \"y\": 0}" );
+        const Json& r = static_cast<const Json&>( a )["x"];
+        const Json& v = JsonPath( "x.v" ).get( a );
+
+        Json* c = new Json( a );
+        a["y"] = 5;
+        a["x"]["w"] = 6;
+        delete c; // must not take `r` or `v` with it
+
+        REQUIRE( r.toString() == "{ \"v\": [ 1, 2 ], \"w\": 6 }" );
+        REQUIRE( v.toString() == "[ 1, 2 ]" );
+        REQUIRE( a.toString() == "{ \"x\": { \"v\": [ 1, 2 ], \"w\": 6 }, \"y\": 5 }" );
+    }
+
+    SECTION( "Iterators Taken Before A Copy" )
+    {
+        Json a = JsonArray( 1, 2, 3 );
+        Json::iterator first = a.begin();
+        Json c = a;
+        Json::iterator last = a.end();
+
+        int sum = 0;
+        for( Json::iterator it = first; it != last; ++it ) {
+            sum += ( *it ).getAs<int>();
+            *it = 0;
+        }
+        REQUIRE( sum == 6 );
+        REQUIRE( a.toString() == "[ 0, 0, 0 ]" );
+        REQUIRE( c.toString() == "[ 1, 2, 3 ]" );
+    }
+
+    SECTION( "Shared Base Across Threads" )
+    {
+        const Json base = Parser::parse( "{\"items\": [1, 2, 3], \"meta\": {\"v\": 1}}" );
+
+        std::vector<std::thread> workers;
+        std::vector<std::string> results( 4 );
+        for( int t = 0; t < 4; ++t ) {
+            workers.emplace_back( [&base, &results, t]() {
+                for( int i = 0; i < 200; ++i ) {
+                    Json request = base;
+                    request["meta"]["worker"] = t;
+                    request["items"].addElementToArray( i );
+                    if( i == 199 ) results[t] = request["meta"].toString();
+                }
+            });
+        }
+        for( auto& w : workers ) w.join();
+
+        for( int t = 0; t < 4; ++t )
+            REQUIRE( results[t] == "{ \"v\": 1, \"worker\": " + std::to_string( t ) + " }" );
+        REQUIRE( base.toString() == "{ \"items\": [ 1, 2, 3 ], \"meta\": { \"v\": 1 } }" );
+    }
+}
+
+// =============================================================================
+// [Test 30] Move & In-Place Construction
+// Verify rvalue builders, emplace, reserve and initializer-list literals.
+// =============================================================================
+TEST_CASE( "Move & In-Place Construction", "[json][build]" )
+{
+    SECTION( "Initializer-List Literals" )
+    {
+        Json js = JsonObject( {
+            { "id",   7 },
+            { "name", "kim" },
+            { "tags", JsonArray( { "a", 2, 3.5, true } ) },
+            { "geo",  JsonObject( { { "lat", 37.5 } } ) }
+        } );
+
+        REQUIRE( js.toString() == "{ \"id\": 7, \"name\": \"kim\", \"tags\": [ \"a\", 2, 3.5, true ], \"geo\": { \"lat\": 37.5 } }" );
+        REQUIRE( JsonArray( {} ).size() == 0 );
+        REQUIRE( JsonObject( { { "a", 1 }, { "a", 2 } } ).toString() == "{ \"a\": 2 }" );
+    }
+
+    SECTION( "Emplace Builds Children In Place" )
+    {
+        Json root = JsonObject();
+        Json& users = root.emplace( "users", JsonType::ARRAY );
+        users.reserve( 2 );
+
+        Json& first = users.emplaceBack( JsonType::OBJECT );
+        first.emplace( "id", 1 );
+        first.emplace( "name", "lee" );
+        users.emplaceBack( "second" );
+
+        REQUIRE( first["name"].getAs<std::string>() == "lee" ); // still valid after reserve(2)
+        REQUIRE( root.toString() == "{ \"users\": [ { \"id\": 1, \"name\": \"lee\" }, \"second\" ] }" );
+
+        root.emplace( "users", 0 ); // replaces the existing member
+        REQUIRE( root.size() == 1 );
+        REQUIRE( root["users"].getAs<int>() == 0 );
+    }
+
+    SECTION( "Rvalue Builders Move Their Argument" )
+    {
+        Json child = JsonArray( 1, 2, 3 );
+        Json parent = JsonObject();
+        parent.addObject( "child", std::move( child ) );
+        REQUIRE( parent["child"].size() == 3 );
+        REQUIRE( child.isNull() );
+
+        Json extra = JsonObject( "x", 1 ).addObject( "y", 2 );
+        parent.addObject( std::move( extra ) );
+        REQUIRE( parent.toString() == "{ \"child\": [ 1, 2, 3 ], \"x\": 1, \"y\": 2 }" );
+
+        Json empty = JsonObject();
+        empty.addObject( parent ); // merge into an empty object shares the members
+        REQUIRE( empty.toString() == parent.toString() );
+
+        std::string text = "moved";
+        Json arr = JsonArray();
+        arr.addElementToArray( std::move( text ), Json( JsonType::OBJECT ), 4 );
+        REQUIRE( arr.toString() == "[ \"moved\", {  }, 4 ]" );
+    }
+
+    SECTION( "Reserve" )
+    {
+        Json arr = JsonArray();
+        arr.reserve( 1000 );
+        REQUIRE( arr.size() == 0 );
+        Json& head = arr.emplaceBack( 0 );
+        for( int i = 1; i < 1000; ++i ) arr.emplaceBack( i );
+        REQUIRE( head.getAs<int>() == 0 );
+
+        Json obj = JsonObject();
+        obj.reserve( 20 );
+        for( int i = 0; i < 20; ++i ) obj.emplace( "k" + std::to_string( i ), i );
+        REQUIRE( obj["k19"].getAs<int>() == 19 );
+
+        Json num = 5;
+        num.reserve( 10 ); // scalars are left unchanged
+        REQUIRE( num.getAs<int>() == 5 );
+
+        const Json base = JsonArray( 1, 2 );
+        Json copy = base;
+        copy.reserve( 10 ); // reserving on a copy does not touch the original
+        copy.emplaceBack( 3 );
+        REQUIRE( base.size() == 2 );
+    }
+}
+
+// =============================================================================
+// [Test 31] Tape Document
+// Verify the read-only tape representation against the Json tree.
+// =============================================================================
+TEST_CASE( "Tape Document", "[parser][tape]" )
+{
+    const std::string text =
+        "{\"id\": 42, \"name\": \"tape \\\"json\\\"\", \"score\": -2.5, \"ok\": true, \"none\": null,"
+        " \"tags\": [\"a\", [], {}, [1, [2, 3]], \"z\"], \"geo\": {\"lat\": 37.5665, \"lng\": 126.978}}";
+
+    SECTION( "Read API" )
+    {
+        TapeDocument doc  = Parser::parseTape( text );
+        TapeView     root = doc.root();
+
+        REQUIRE( root.isObject() );
+        REQUIRE( root.size() == 7 );
+        REQUIRE( root["id"].getAs<int>() == 42 );
+        REQUIRE( root["name"].getAs<std::string>() == "tape \"json\"" );
+        REQUIRE( root["score"].getAs<double>() == -2.5 );
+        REQUIRE( root["ok"].getAs<bool>() == true );
+        REQUIRE( root["none"].isNull() );
+        REQUIRE( root["geo"]["lng"].getAs<double>() == 126.978 );
+        REQUIRE( root.contains( "geo" ) );
+        REQUIRE_FALSE( root.contains( "missing" ) );
+        REQUIRE( root.keys() == std::vector<std::string>{ "id", "name", "score", "ok", "none", "tags", "geo" } );
+
+        // Containers are skipped by their span
+        TapeView tags = root["tags"];
+        REQUIRE( tags.size() == 5 );
+        REQUIRE( tags[1].isArray() );
+        REQUIRE( tags[1].size() == 0 );
+        REQUIRE( tags[2].isObject() );
+        REQUIRE( tags[3][1][1].getAs<int>() == 3 );
+        REQUIRE( tags[4].getAs<std::string>() == "z" );
+
+        std::string joined;
+        for( auto it = tags.begin(); it != tags.end(); ++it )
+            joined += std::to_string( it.index() );
+        REQUIRE( joined == "01234" );
+
+        std::string members;
+        for( const auto& item : root["geo"].items() )
+            members += item.key().toString() + "=" + item.value().getAs<std::string>() + ";";
+        REQUIRE( members == "lat=37.5665;lng=126.978;" );
+
+        REQUIRE_THROWS_AS( root["missing"], TinyJsonException );
+        REQUIRE_THROWS_AS( tags[5], TinyJsonException );
+        REQUIRE_THROWS_AS( root[0], TinyJsonException );
+    }
+
+    SECTION( "Same Result As Json" )
+    {
+        const TapeDocument doc = Parser::parseTape( text );
+        REQUIRE( doc.root().toString() == Parser::parse( text ).toString() );
+        REQUIRE( doc.root().toString( ToStringType::Pretty ) == Parser::parse( text ).toString( ToStringType::Pretty ) );
+
+        Json copy = doc.root()["tags"].toJson();
+        copy.addElementToArray( "added" );
+        REQUIRE( copy.size() == 6 );
+        REQUIRE( doc.root()["tags"].size() == 5 );
+
+        // Duplicate keys: first position, last value, counted once
+        std::string dup = "{\"a\": 1, \"b\": [1, {\"k\": 1, \"k\": 2}], \"\\u0061\": {\"n\": 2}, \"a\": 2.5, \"c\": \"s\"";
+        for( int i = 0; i < 40; ++i ) // past the pairwise comparison
+            dup += ", \"k" + std::to_string( i % 20 ) + "\": " + std::to_string( i );
+        dup += "}";
+
+        const TapeDocument dupDoc = Parser::parseTape( dup );
+        const Json         dupJs  = Parser::parse( dup );
+        const TapeView     root   = dupDoc.root();
+        REQUIRE( root.toString() == dupJs.toString() );
+        REQUIRE( root.size() == dupJs.size() );
+        REQUIRE( root.size() == 23 );
+        REQUIRE( root.keys() == dupJs.keys() );
+        REQUIRE( root["a"].getAs<double>() == 2.5 );
+        REQUIRE( root["b"][1].size() == 1 );
+        REQUIRE( root["b"][1]["k"].getAs<int>() == 2 );
+        REQUIRE( root["k5"].getAs<int>() == 25 );
+
+        std::size_t members = 0;
+        for( const auto& item : root.items() ) {
+            REQUIRE( item.value().toString() == dupJs[item.key().toString()].toString() );
+            ++members;
+        }
+        REQUIRE( members == 23 );
+    }
+
+    SECTION( "Tape Layout" )
+    {
+        // object + key + two-word number
+        REQUIRE( Parser::parseTape( "{\"a\": 1}" ).tapeSize() == 4 );
+        // array + string + literal + two-word double
+        REQUIRE( Parser::parseTape( "[\"s\", null, 0.5]" ).tapeSize() == 5 );
+        REQUIRE( Parser::parseTape( "\"\\u00e9\"" ).root().getAs<std::string>() == "\xC3\xA9" );
+        REQUIRE( Parser::parseTape( "\"a\\u0000b\"" ).root().getAs<StringView>().size() == 3 );
+
+        TapeDocument empty;
+        REQUIRE_FALSE( empty.root().isValid() );
+        REQUIRE( empty.root().size() == 0 );
+    }
+
+    SECTION( "Numbers" )
+    {
+        TapeDocument doc = Parser::parseTape( "[-9223372036854775808, 18446744073709551615, 123456789012345678901234567890, 1e300, 3]" );
+        TapeView     arr = doc.root();
+
+        REQUIRE( arr[0].getAs<long long>() == std::numeric_limits<long long>::min() );
+        REQUIRE( arr[1].getAs<unsigned long long>() == std::numeric_limits<unsigned long long>::max() );
+        REQUIRE( arr[2].isInt() );
+        REQUIRE( arr[2].getAs<std::string>() == "123456789012345678901234567890" );
+        REQUIRE_THROWS_AS( arr[2].getAs<long long>(), TinyJsonException );
+        REQUIRE( arr[3].getAs<double>() == 1e300 );
+        REQUIRE_THROWS_AS( arr[1].getAs<int>(), TinyJsonException );
+
+        int small = 0;
+        REQUIRE( arr[4].tryGetAs( small ) );
+        REQUIRE( small == 3 );
+        REQUIRE_FALSE( arr[1].tryGetAs( small ) );
+        REQUIRE( arr.toString() == "[ -9223372036854775808, 18446744073709551615, 123456789012345678901234567890, 1e+300, 3 ]" );
+    }
+
+    SECTION( "Errors" )
+    {
+        REQUIRE_THROWS_AS( Parser::parseTape( "{\"a\": }" ), TinyJsonException );
+
+        TapeDocument      doc = Parser::parseTape( "[1]" );
+        const ParseResult bad = Parser::tryParse( "[1 2]", doc );
+        REQUIRE_FALSE( bad );
+        REQUIRE( bad.error == ParseError::ExpectedArrayEnd );
+        REQUIRE( doc.root().size() == 1 ); // unchanged
+
+        ParseOptions shallow;
+        shallow.maxDepth = 2;
+        REQUIRE( Parser::tryParse( "[[[1]]]", doc, shallow ).error == ParseError::DepthExceeded );
+        REQUIRE( Parser::tryParse( "[[1]]", doc, shallow ) );
+        REQUIRE( doc.root()[0][0].getAs<int>() == 1 );
+    }
+}
+
+// =============================================================================
+// [Test 32] Heterogeneous Keys
+// Verify key lookups from literals and buffer slices without allocating.
+// =============================================================================
+
+TEST_CASE( "Heterogeneous Keys", "[json][lookup]" )
+{
+    Json js = Parser::parse( "{\"user\": {\"id\": 7, \"name\": \"kim\"}, \"a\\u0000b\": 1}" );
+    for( int i = 0; i < 20; ++i ) js["user"]["k" + std::to_string( i )] = i; // indexed object
+
+    SECTION( "Literal, String And Slice Keys" )
+    {
+        const Json&       cjs    = js;
+        const char        buf[] = "GET /user/name HTTP/1.1";
+        const StringView  slice( buf + 10, 4 ); // "name", not null-terminated
+        const std::string owned = "id";
+
+        REQUIRE( cjs["user"]["id"].getAs<int>() == 7 );
+        REQUIRE( cjs["user"][slice].getAs<std::string>() == "kim" );
+        REQUIRE( cjs["user"][owned].isInt() );
+        REQUIRE( cjs["user"]["k19"].getAs<int>() == 19 );
+        REQUIRE( cjs["user"].contains( slice ) );
+        REQUIRE_FALSE( cjs["user"].contains( StringView( buf, 3 ) ) );
+        REQUIRE_THROWS_AS( cjs["user"][StringView( buf, 3 )], TinyJsonException );
+
+        js["user"][slice] = "lee"; // non-const: existing key, no insertion
+        REQUIRE( js["user"]["name"].getAs<std::string>() == "lee" );
+        REQUIRE( js["user"].size() == 22 );
+    }
+
+    SECTION( "Keys With Explicit Length" )
+    {
+        REQUIRE( js.contains( StringView( "a\0b", 3 ) ) );
+        REQUIRE_FALSE( js.contains( "a" ) );
+        REQUIRE( js[StringView( "a\0b", 3 )].getAs<int>() == 1 );
+
+        const char raw[] = "score=99";
+        js.addObject( StringView( raw, 5 ), 99 );
+        js.emplace( StringView( raw + 6, 2 ), true );
+        REQUIRE( js["score"].getAs<int>() == 99 );
+        REQUIRE( js["99"].getAs<bool>() );
+        REQUIRE( JsonObject( StringView( raw, 5 ), "x" ).toString() == "{ \"score\": \"x\" }" );
+    }
+
+    SECTION( "Iterator Keys" )
+    {
+        Json copy = JsonObject();
+        for( auto it = js["user"].begin(); it != js["user"].end(); ++it ) {
+            Json::JsonKey key = it.key();
+            REQUIRE( js["user"].contains( key ) );
+            copy.addObject( key, it.value() );
+        }
+        REQUIRE( copy.size() == js["user"].size() );
+    }
+}
+
+// =============================================================================
+// [Test 33] Compiled Paths
+// Verify JsonPath parsing (pointer and dotted forms) and evaluation.
+// =============================================================================
+TEST_CASE( "Compiled Paths", "[json][path]" )
+{
+    const Json doc = Parser::parse(
+        "{\"user\": {\"profile\": {\"id\": 7, \"tags\": [\"a\", \"b\", {\"c\": true}]}},"
+        " \"a/b\": 1, \"m~n\": 2, \"10\": \"ten\", \"\": \"empty\"}" );
+
+    SECTION( "JSON Pointer" )
+    {
+        REQUIRE( JsonPath( "/user/profile/id" ).get( doc ).getAs<int>() == 7 );
+        REQUIRE( JsonPath( "/user/profile/tags/1" ).get( doc ).getAs<std::string>() == "b" );
+        REQUIRE( JsonPath( "/user/profile/tags/2/c" ).get( doc ).getAs<bool>() );
+        REQUIRE( JsonPath( "/a~1b" ).get( doc ).getAs<int>() == 1 );
+        REQUIRE( JsonPath( "/m~0n" ).get( doc ).getAs<int>() == 2 );
+        REQUIRE( JsonPath( "/10" ).get( doc ).getAs<std::string>() == "ten" ); // numeric token on an object
+        REQUIRE( JsonPath( "/" ).get( doc ).getAs<std::string>() == "empty" );
+        REQUIRE( &JsonPath( "" ).get( doc ) == &doc );
+        REQUIRE( JsonPath( "" ).depth() == 0 );
+
+        REQUIRE_FALSE( JsonPath( "/user/profile/tags/01" ).exists( doc ) ); // leading zero is not an index
+        REQUIRE_FALSE( JsonPath( "/user/profile/tags/3" ).exists( doc ) );
+        REQUIRE_FALSE( JsonPath( "/user/profile/id/x" ).exists( doc ) );
+        REQUIRE_THROWS_AS( JsonPath( "/a~2" ), TinyJsonException );
+        REQUIRE_THROWS_AS( JsonPath( "/missing" ).get( doc ), TinyJsonException );
+    }
+
+    SECTION( "Dotted Form" )
+    {
+        REQUIRE( JsonPath( "user.profile.id" ).get( doc ).getAs<int>() == 7 );
+        REQUIRE( JsonPath( "user.profile.tags[2].c" ).get( doc ).getAs<bool>() );
+        REQUIRE( JsonPath( "user.profile.tags" ).depth() == 3 );
+        REQUIRE( JsonPath( "[1]" ).get( JsonArray( 5, 6 ) ).getAs<int>() == 6 );
+        REQUIRE( JsonPath( "[0][1]" ).get( Parser::parse( "[[1, 2]]" ) ).getAs<int>() == 2 );
+        REQUIRE_FALSE( JsonPath( "user[0]" ).exists( doc ) ); // [n] never names a member
+
+        const char* bad[] = { "a..b", "a.", ".a", "a[", "a[x]", "a[]", "a[1]b" };
+        for( const char* p : bad )
+            REQUIRE_THROWS_AS( JsonPath( p ), TinyJsonException );
+    }
+
+    SECTION( "Reuse Across Documents" )
+    {
+        const JsonPath id( "/user/id" );
+        const JsonPath last( "/user/k15" );
+
+        for( int i = 0; i < 50; ++i ) {
+            // Alternate two member orders, and grow past the linear-scan size
+            Json user = JsonObject();
+            if( i % 2 ) user.addObject( "id", i ).addObject( "name", "x" );
+            else        user.addObject( "name", "x" ).addObject( "id", i );
+            for( int k = 0; k < 16 && i % 3 == 0; ++k ) user.addObject( "k" + std::to_string( k ), k );
+
+            const Json msg = JsonObject( "user", user );
+            REQUIRE( id.get( msg ).getAs<int>() == i );
+            REQUIRE( last.exists( msg ) == ( i % 3 == 0 ) );
+        }
+
+        JsonPath copy = id; // copies keep working
+        REQUIRE( copy.get( Parser::parse( "{\"user\": {\"id\": 3}}" ) ).getAs<int>() == 3 );
+        REQUIRE( copy.str() == "/user/id" );
+    }
+
+    SECTION( "Shared Between Threads" )
+    {
+        const JsonPath path( "meta.v" );
+        const Json     first  = Parser::parse( "{\"meta\": {\"v\": 1, \"w\": 0}}" );
+        const Json     second = Parser::parse( "{\"meta\": {\"w\": 0, \"v\": 2}}" );
+
+        std::vector<std::thread> workers;
+        std::vector<int>         sums( 4, 0 );
+        for( int t = 0; t < 4; ++t ) {
+            workers.emplace_back( [&, t]() {
+                for( int i = 0; i < 1000; ++i )
+                    sums[t] += path.get( ( i + t ) % 2 ? first : second ).getAs<int>();
+            });
+        }
+        for( auto& w : workers ) w.join();
+
+        for( int t = 0; t < 4; ++t )
+            REQUIRE( sums[t] == 1500 );
+    }
+
+    SECTION( "Lazy Documents" )
+    {
+        const Json lazy = Parser::parseLazy( std::string( "{\"a\": {\"b\": [10, {\"c\": 20}]}}" ) );
+        REQUIRE( JsonPath( "a.b[1].c" ).get( lazy ).getAs<int>() == 20 );
+    }
+}